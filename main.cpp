@@ -342,8 +342,7 @@ int main(int argc, char * argv[])
     //======================================
 
     // 等待所有任务执行完成
-    while (xht_pool.task_count() > 0)
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    xht_pool.wait_idle();
 
     // 关闭线程池
     xht_pool.shutdown();
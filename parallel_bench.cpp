@@ -0,0 +1,170 @@
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    parallel_bench.cpp
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：parallel_bench.cpp
+ * 创建日期：2026年10月16日
+ * 文件标识：
+ * 文件摘要：对比 xparallel.h 中的并行算法（parallel_reduce、parallel_inclusive_scan、
+ *          parallel_sort）与相应的 std:: 顺序版本的耗时。
+ * 
+ * 当前版本：1.0.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：
+ * 
+ * 历史版本：
+ * 原作者  ：
+ * 完成日期：
+ * 版本摘要：
+ * </pre>
+ */
+
+#include "xparallel.h"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::chrono::steady_clock x_clock_t;
+
+/**********************************************************/
+/**
+ * @brief 执行 xfunc，返回耗时（毫秒）。
+ */
+template< typename _Func >
+static double time_ms(_Func && xfunc)
+{
+    x_clock_t::time_point xtm_begin = x_clock_t::now();
+    xfunc();
+    return std::chrono::duration< double, std::milli >(x_clock_t::now() - xtm_begin).count();
+}
+
+/**********************************************************/
+/**
+ * @brief 输出一项对比结果。
+ */
+static void print_result(const char * xszt_name, size_t xcount, double xseq_ms, double xpar_ms, bool xmatched)
+{
+    printf("%-16s n = %11zu    std = %10.2f ms    parallel = %10.2f ms    speedup = %6.2fx    %s\n",
+           xszt_name,
+           xcount,
+           xseq_ms,
+           xpar_ms,
+           (xpar_ms > 0.0) ? (xseq_ms / xpar_ms) : 0.0,
+           xmatched ? "ok" : "MISMATCH");
+}
+
+/**********************************************************/
+/**
+ * @brief 以 xcount 个元素对比各个并行算法与 std:: 顺序版本。
+ */
+static void run_bench(x_threadpool_t & xht_pool, size_t xcount)
+{
+    std::mt19937 xrand(static_cast< unsigned int >(xcount));
+
+    std::vector< int64_t > xvec_data(xcount);
+    for (int64_t & xvalue : xvec_data)
+        xvalue = static_cast< int64_t >(xrand() % 1000);
+
+    const int64_t * xfirst = xvec_data.data();
+    const int64_t * xlast  = xvec_data.data() + xcount;
+
+    //======================================
+    // reduce
+
+    int64_t xseq_sum = 0;
+    int64_t xpar_sum = 0;
+    double  xseq_ms  = time_ms([&]() { xseq_sum = std::accumulate(xfirst, xlast, int64_t(0)); });
+    double  xpar_ms  = time_ms([&]()
+    {
+        xpar_sum = parallel_reduce(xht_pool, xfirst, xlast, 0, int64_t(0),
+                                   [](int64_t xleft, int64_t xright) { return xleft + xright; });
+    });
+    print_result("reduce", xcount, xseq_ms, xpar_ms, (xseq_sum == xpar_sum));
+
+    //======================================
+    // inclusive scan
+
+    {
+        std::vector< int64_t > xvec_seq(xcount);
+        std::vector< int64_t > xvec_par(xcount);
+        xseq_ms = time_ms([&]() { std::partial_sum(xfirst, xlast, xvec_seq.begin()); });
+        xpar_ms = time_ms([&]() { parallel_inclusive_scan(xht_pool, xfirst, xlast, xvec_par.data()); });
+        print_result("inclusive_scan", xcount, xseq_ms, xpar_ms, (xvec_seq == xvec_par));
+    }
+
+    //======================================
+    // sort
+
+    {
+        std::vector< uint32_t > xvec_seq(xcount);
+        for (uint32_t & xvalue : xvec_seq)
+            xvalue = static_cast< uint32_t >(xrand());
+        std::vector< uint32_t > xvec_par(xvec_seq);
+
+        xseq_ms = time_ms([&]() { std::sort(xvec_seq.begin(), xvec_seq.end()); });
+        xpar_ms = time_ms([&]() { parallel_sort(xht_pool, xvec_par.data(), xvec_par.data() + xcount); });
+        print_result("sort", xcount, xseq_ms, xpar_ms, (xvec_seq == xvec_par));
+    }
+}
+
+//====================================================================
+
+/**
+ * 用法：parallel_bench [最大元素数量（默认 100000000）] [工作线程数量（默认为 CPU 核数）]
+ * 元素数量从 1M 起，按 10 倍递增至最大元素数量（如 1000000000，需约 24 GB 内存）。
+ */
+int main(int argc, char * argv[])
+{
+    size_t xmax_count = (argc > 1) ? static_cast< size_t >(strtoull(argv[1], nullptr, 10)) : 100000000;
+    size_t xthreads   = (argc > 2) ? static_cast< size_t >(strtoull(argv[2], nullptr, 10))
+                                   : static_cast< size_t >(std::thread::hardware_concurrency());
+
+    // 调用方线程也参与执行，因此工作线程数量比 CPU 核数少一个
+    x_threadpool_t xht_pool;
+    if (!xht_pool.startup((xthreads > 1) ? (xthreads - 1) : 1))
+    {
+        printf("startup return false!\n");
+        return -1;
+    }
+
+    printf("worker threads : %zu (+ caller)\n", xht_pool.size());
+
+    for (size_t xcount = 1000000; xcount <= xmax_count; xcount *= 10)
+    {
+        run_bench(xht_pool, xcount);
+    }
+
+    xht_pool.shutdown();
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    priority_bench.cpp
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：priority_bench.cpp
+ * 创建日期：2026年10月16日
+ * 文件标识：
+ * 文件摘要：测试 线程池 的 “优先级车道” 功能：低优先级任务对象使线程池饱和时，
+ *          统计高优先级任务对象的排队延迟（p50/p99）。
+ * 
+ * 当前版本：1.0.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：
+ * 
+ * 历史版本：
+ * 原作者  ：
+ * 完成日期：
+ * 版本摘要：
+ * </pre>
+ */
+
+#include "xthreadpool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::chrono::steady_clock x_clock_t;
+
+/**********************************************************/
+/**
+ * @brief 忙等待指定的微秒数（模拟 CPU 密集型的任务对象）。
+ */
+static void busy_wait_us(int xus)
+{
+    x_clock_t::time_point xtm_end = x_clock_t::now() + std::chrono::microseconds(xus);
+    while (x_clock_t::now() < xtm_end)
+    {
+    }
+}
+
+/**********************************************************/
+/**
+ * @brief 在低优先级任务对象的饱和负载下，以指定优先级提交探测任务对象，
+ *        返回各个探测任务对象从提交到开始执行的延迟（微秒）。
+ */
+static std::vector< double > run_probes(size_t xpriority)
+{
+    x_threadpool_t xht_pool;
+
+    x_threadpool_t::x_config_t xconfig;
+    xconfig.xthds      = 4;
+    xconfig.priorities = 2;
+    if (!xht_pool.startup(xconfig))
+    {
+        printf("startup return false!\n");
+        return std::vector< double >();
+    }
+
+    // 低优先级的探测任务对象需要排在积压的任务对象之后，减少其探测次数
+    const int xprobe_count = (0 == xpriority) ? 50 : 1000;
+    std::vector< double > xvec_latency(xprobe_count, 0.0);
+    std::atomic< int > xprobe_done(0);
+
+    for (int iter = 0; iter < xprobe_count; ++iter)
+    {
+        // 保持低优先级任务队列的积压（约 2000 个、每个 50 微秒）
+        while (xht_pool.lane_size(0) < 2000)
+        {
+            xht_pool.submit_priority(0, []() { busy_wait_us(50); });
+        }
+
+        x_clock_t::time_point xtm_submit = x_clock_t::now();
+        xht_pool.submit_priority(xpriority,
+            [&xvec_latency, &xprobe_done, iter, xtm_submit]()
+            {
+                xvec_latency[iter] = std::chrono::duration< double, std::micro >(
+                                        x_clock_t::now() - xtm_submit).count();
+                xprobe_done.fetch_add(1);
+            });
+
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+
+        // 等待低优先级的探测任务对象执行，避免积压的任务对象持续增加
+        if (0 == xpriority)
+        {
+            while (xprobe_done.load() <= iter)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    while (xprobe_done.load() < xprobe_count)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    xht_pool.shutdown();
+    xht_pool.cleanup_task();
+
+    return xvec_latency;
+}
+
+/**********************************************************/
+/**
+ * @brief 输出延迟的统计结果。
+ */
+static void print_latency(const char * xszt_name, std::vector< double > xvec_latency)
+{
+    if (xvec_latency.empty())
+        return;
+
+    std::sort(xvec_latency.begin(), xvec_latency.end());
+    size_t xcount = xvec_latency.size();
+    printf("%-22s p50 = %10.1f us    p99 = %10.1f us    max = %10.1f us\n",
+           xszt_name,
+           xvec_latency[xcount / 2],
+           xvec_latency[(xcount * 99) / 100],
+           xvec_latency[xcount - 1]);
+}
+
+//====================================================================
+
+int main(int argc, char * argv[])
+{
+    print_latency("probe priority = 0 :", run_probes(0));
+    print_latency("probe priority = 1 :", run_probes(1));
+
+    return 0;
+}
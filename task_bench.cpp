@@ -0,0 +1,313 @@
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    task_bench.cpp
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：task_bench.cpp
+ * 创建日期：2026年10月17日
+ * 文件标识：
+ * 文件摘要：对比 submit_task_ex() 的任务对象（直接在 tuple 上展开参数进行调用）
+ *          与以 std::bind() 封装的任务对象：每个任务对象的参数拷贝/移动次数、
+ *          耗时，以及（Linux 平台上 perf_event_open 可用时）执行的指令数。
+ *          线程池的容量上限为 1，唯一的容量由一个阻塞的任务对象占用，
+ *          其后提交的任务对象均按 ECV_OVERFLOW_CALLER_RUNS 策略在提交方线程中直接执行，
+ *          所统计的是任务对象 创建、执行、销毁 的开销，不含线程间调度的干扰。
+ * 
+ * 当前版本：1.0.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：
+ * 
+ * 历史版本：
+ * 原作者  ：
+ * 完成日期：
+ * 版本摘要：
+ * </pre>
+ */
+
+#include "xthreadpool.h"
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // defined(__linux__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::chrono::steady_clock x_clock_t;
+
+/**
+ * @class x_counted_t
+ * @brief 统计拷贝/移动次数的参数类型。
+ */
+class x_counted_t
+{
+public:
+    static std::atomic< size_t > _S_copies;
+    static std::atomic< size_t > _S_moves;
+
+    static void reset(void)
+    {
+        _S_copies.store(0);
+        _S_moves .store(0);
+    }
+
+public:
+    explicit x_counted_t(int xvalue) : m_xvalue(xvalue) { }
+
+    x_counted_t(const x_counted_t & xobject) : m_xvalue(xobject.m_xvalue)
+    {
+        _S_copies.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    x_counted_t(x_counted_t && xobject) : m_xvalue(xobject.m_xvalue)
+    {
+        _S_moves.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int m_xvalue;
+};
+
+std::atomic< size_t > x_counted_t::_S_copies(0);
+std::atomic< size_t > x_counted_t::_S_moves(0);
+
+/**
+ * @class x_bind_task_t
+ * @brief 以 std::bind() 封装的任务对象（submit_task_ex() 此前的实现方式，作为对比的基准）。
+ */
+template< typename _Binder >
+class x_bind_task_t : public x_task_t
+{
+public:
+    explicit x_bind_task_t(_Binder && xbinder) : m_xbinder(std::move(xbinder)) { }
+
+    virtual void run(x_running_checker_t * xchecker_ptr) override
+    {
+        m_xbinder();
+    }
+
+private:
+    _Binder m_xbinder;
+};
+
+/**********************************************************/
+/**
+ * @brief 以 std::bind() 封装任务对象，再提交至线程池。
+ */
+template< typename _Func, typename... _Args >
+static void submit_bind(x_threadpool_t & xht_pool, _Func && xfunc, _Args && ... xargs)
+{
+    auto xbinder = std::bind(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+    xht_pool.submit_task(new x_bind_task_t< decltype(xbinder) >(std::move(xbinder)));
+}
+
+/**
+ * @class x_inst_counter_t
+ * @brief 统计当前线程在用户态执行的指令数；perf_event_open 不可用时，返回 -1。
+ */
+class x_inst_counter_t
+{
+public:
+    x_inst_counter_t(void) : m_xfd(-1) { }
+
+    ~x_inst_counter_t(void)
+    {
+#if defined(__linux__)
+        if (m_xfd >= 0)
+            close(m_xfd);
+#endif // defined(__linux__)
+    }
+
+    void open(void)
+    {
+#if defined(__linux__)
+        struct perf_event_attr xattr;
+        memset(&xattr, 0, sizeof(xattr));
+        xattr.type           = PERF_TYPE_HARDWARE;
+        xattr.size           = sizeof(xattr);
+        xattr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+        xattr.disabled       = 1;
+        xattr.exclude_kernel = 1;
+        xattr.exclude_hv     = 1;
+        m_xfd = static_cast< int >(syscall(__NR_perf_event_open, &xattr, 0, -1, -1, 0));
+        if (m_xfd >= 0)
+        {
+            ioctl(m_xfd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_xfd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif // defined(__linux__)
+    }
+
+    long long stop(void)
+    {
+        long long xcount = -1;
+#if defined(__linux__)
+        if ((m_xfd < 0) || (0 != ioctl(m_xfd, PERF_EVENT_IOC_DISABLE, 0)) ||
+            (sizeof(xcount) != read(m_xfd, &xcount, sizeof(xcount))))
+        {
+            xcount = -1;
+        }
+#endif // defined(__linux__)
+        return xcount;
+    }
+
+private:
+    int m_xfd;
+};
+
+//====================================================================
+
+static std::atomic< int64_t > _S_sum(0);
+
+static void task_counted(x_counted_t xarg)
+{
+    _S_sum.fetch_add(xarg.m_xvalue, std::memory_order_relaxed);
+}
+
+static void task_value(int xvalue)
+{
+    _S_sum.fetch_add(xvalue, std::memory_order_relaxed);
+}
+
+static void task_string(std::string xstr, int xvalue)
+{
+    _S_sum.fetch_add(static_cast< int64_t >(xstr.size()) + xvalue, std::memory_order_relaxed);
+}
+
+/**********************************************************/
+/**
+ * @brief 在提交方线程中直接执行 xcount 个任务对象（参看文件摘要），
+ *        输出每个任务对象的参数拷贝/移动次数、耗时与指令数。
+ */
+template< typename _Submit >
+static void run_bench(const char * xszt_name, size_t xcount, _Submit && xsubmit)
+{
+    x_threadpool_t::x_config_t xconfig;
+    xconfig.xthds           = 1;
+    xconfig.max_tasks       = 1;
+    xconfig.overflow_policy = x_threadpool_t::ECV_OVERFLOW_CALLER_RUNS;
+
+    x_threadpool_t xht_pool;
+    if (!xht_pool.startup(xconfig))
+    {
+        printf("startup return false!\n");
+        return;
+    }
+
+    std::promise< void > xgate;
+    std::shared_future< void > xgate_future = xgate.get_future().share();
+    xht_pool.submit_task_ex([xgate_future](void) { xgate_future.wait(); });
+
+    // 预热（线程本地缓存等）
+    for (size_t xiter = 0; xiter < 1024; ++xiter)
+        xsubmit(xht_pool);
+
+    x_counted_t::reset();
+
+    x_inst_counter_t xinst;
+    xinst.open();
+    x_clock_t::time_point xtm_begin = x_clock_t::now();
+
+    for (size_t xiter = 0; xiter < xcount; ++xiter)
+        xsubmit(xht_pool);
+
+    double    xns    = std::chrono::duration< double, std::nano >(x_clock_t::now() - xtm_begin).count();
+    long long xinsts = xinst.stop();
+
+    xgate.set_value();
+    xht_pool.wait_idle();
+    xht_pool.shutdown();
+
+    printf("%-26s copies/task = %5.2f    moves/task = %5.2f    %7.1f ns/task    ",
+           xszt_name,
+           static_cast< double >(x_counted_t::_S_copies.load()) / xcount,
+           static_cast< double >(x_counted_t::_S_moves .load()) / xcount,
+           xns / xcount);
+    if (xinsts >= 0)
+        printf("%7.1f instructions/task\n", static_cast< double >(xinsts) / xcount);
+    else
+        printf("instructions/task = n/a (perf_event_open unavailable)\n");
+}
+
+//====================================================================
+
+/**
+ * 用法：task_bench [任务对象数量（默认 1000000）]
+ */
+int main(int argc, char * argv[])
+{
+    size_t xcount = (argc > 1) ? static_cast< size_t >(strtoull(argv[1], nullptr, 10)) : 1000000;
+    if (xcount < 1)
+        xcount = 1;
+
+    x_counted_t       xlvalue(1);
+    const std::string xstr(48, 'x');   // 超出 SSO 长度，拷贝时须分配内存
+
+    run_bench("bind   (rvalue counted)", xcount,
+              [](x_threadpool_t & xht_pool) { submit_bind(xht_pool, task_counted, x_counted_t(1)); });
+    run_bench("submit (rvalue counted)", xcount,
+              [](x_threadpool_t & xht_pool) { xht_pool.submit_task_ex(task_counted, x_counted_t(1)); });
+    run_bench("bind   (lvalue counted)", xcount,
+              [&xlvalue](x_threadpool_t & xht_pool) { submit_bind(xht_pool, task_counted, xlvalue); });
+    run_bench("submit (lvalue counted)", xcount,
+              [&xlvalue](x_threadpool_t & xht_pool) { xht_pool.submit_task_ex(task_counted, xlvalue); });
+    run_bench("bind   (int)", xcount,
+              [](x_threadpool_t & xht_pool) { submit_bind(xht_pool, task_value, 1); });
+    run_bench("submit (int)", xcount,
+              [](x_threadpool_t & xht_pool) { xht_pool.submit_task_ex(task_value, 1); });
+    run_bench("bind   (std::string)", xcount,
+              [&xstr](x_threadpool_t & xht_pool) { submit_bind(xht_pool, task_string, std::string(xstr), 1); });
+    run_bench("submit (std::string)", xcount,
+              [&xstr](x_threadpool_t & xht_pool) { xht_pool.submit_task_ex(task_string, std::string(xstr), 1); });
+
+    //======================================
+    // 仅可移动的参数（std::bind 封装的任务对象无法以按值传递的 std::unique_ptr 为形参）
+
+    {
+        x_threadpool_t xht_pool;
+        xht_pool.startup(1);
+
+        std::atomic< int64_t > xsum(0);
+        for (size_t xiter = 0; xiter < 1000; ++xiter)
+        {
+            xht_pool.submit_task_ex([&xsum](std::unique_ptr< int > xptr) { xsum += *xptr; },
+                                    std::unique_ptr< int >(new int(1)));
+        }
+        xht_pool.wait_idle();
+
+        printf("move-only arguments        sum = %lld (expected 1000)\n", static_cast< long long >(xsum.load()));
+    }
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    wakeup_bench.cpp
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：wakeup_bench.cpp
+ * 创建日期：2026年10月17日
+ * 文件标识：
+ * 文件摘要：统计工作线程唤醒的开销：每个任务对象所对应的（进程内所有线程的）
+ *          主动/被动上下文切换次数（以 getrusage() 近似 futex 等待的系统调用次数）
+ *          与耗时。场景包括：所有工作线程均忙碌时的突发提交、
+ *          工作线程均空闲时的逐个提交（提交一个，等待其完成后再提交下一个），
+ *          以及 resize() 减少工作线程数量。
+ * 
+ * 当前版本：1.0.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：
+ * 
+ * 历史版本：
+ * 原作者  ：
+ * 完成日期：
+ * 版本摘要：
+ * </pre>
+ */
+
+#include "xthreadpool.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif // defined(__linux__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+typedef std::chrono::steady_clock x_clock_t;
+
+/**
+ * @struct x_usage_t
+ * @brief  进程的上下文切换次数（Linux 之外的平台上，均为 0）。
+ */
+struct x_usage_t
+{
+    long long m_xvcsw;  ///< 主动切换（等待 futex 等）
+    long long m_xivcsw; ///< 被动切换（时间片用完等）
+
+    static x_usage_t now(void)
+    {
+        x_usage_t xusage = { 0, 0 };
+#if defined(__linux__)
+        struct rusage xrusage;
+        if (0 == getrusage(RUSAGE_SELF, &xrusage))
+        {
+            xusage.m_xvcsw  = xrusage.ru_nvcsw;
+            xusage.m_xivcsw = xrusage.ru_nivcsw;
+        }
+#endif // defined(__linux__)
+        return xusage;
+    }
+};
+
+/**********************************************************/
+/**
+ * @brief 输出 [xtm_begin, now) 期间每个任务对象的上下文切换次数与耗时。
+ */
+static void print_result(const char * xszt_name, size_t xcount,
+                         const x_usage_t & xusage_begin, x_clock_t::time_point xtm_begin)
+{
+    double    xns    = std::chrono::duration< double, std::nano >(x_clock_t::now() - xtm_begin).count();
+    x_usage_t xusage = x_usage_t::now();
+
+    printf("%-28s vcsw/task = %6.3f    ivcsw/task = %6.3f    %9.1f ns/task\n",
+           xszt_name,
+           static_cast< double >(xusage.m_xvcsw  - xusage_begin.m_xvcsw ) / xcount,
+           static_cast< double >(xusage.m_xivcsw - xusage_begin.m_xivcsw) / xcount,
+           xns / xcount);
+}
+
+//====================================================================
+
+/**********************************************************/
+/**
+ * @brief 突发提交：xcount 个任务对象一次性提交，工作线程大多处于忙碌状态。
+ */
+static void bench_burst(size_t xthds, size_t xcount)
+{
+    x_threadpool_t xht_pool;
+    xht_pool.startup(xthds);
+
+    std::atomic< size_t > xsum(0);
+
+    x_usage_t            xusage_begin = x_usage_t::now();
+    x_clock_t::time_point xtm_begin   = x_clock_t::now();
+
+    for (size_t xiter = 0; xiter < xcount; ++xiter)
+    {
+        xht_pool.submit_task_ex([&xsum](void) { xsum.fetch_add(1, std::memory_order_relaxed); });
+    }
+    xht_pool.wait_idle();
+
+    print_result("burst", xcount, xusage_begin, xtm_begin);
+    xht_pool.shutdown();
+}
+
+/**********************************************************/
+/**
+ * @brief 逐个提交：每个任务对象提交时，所有工作线程均处于空闲等待状态。
+ */
+static void bench_sparse(size_t xthds, size_t xcount)
+{
+    x_threadpool_t xht_pool;
+    xht_pool.startup(xthds);
+
+    std::atomic< size_t > xdone(0);
+
+    // 等待所有工作线程进入空闲状态
+    while (xht_pool.idle_count() < xthds)
+        std::this_thread::yield();
+
+    x_usage_t            xusage_begin = x_usage_t::now();
+    x_clock_t::time_point xtm_begin   = x_clock_t::now();
+
+    for (size_t xiter = 0; xiter < xcount; ++xiter)
+    {
+        xht_pool.submit_task_ex([&xdone](void) { xdone.fetch_add(1, std::memory_order_release); });
+        while (xdone.load(std::memory_order_acquire) <= xiter)
+            std::this_thread::yield();
+    }
+
+    print_result("sparse (one at a time)", xcount, xusage_begin, xtm_begin);
+    xht_pool.shutdown();
+}
+
+/**********************************************************/
+/**
+ * @brief resize() 反复减少/恢复工作线程数量（工作线程均空闲时）。
+ */
+static void bench_resize(size_t xthds, size_t xcount)
+{
+    x_threadpool_t xht_pool;
+    xht_pool.startup(xthds);
+
+    x_usage_t            xusage_begin = x_usage_t::now();
+    x_clock_t::time_point xtm_begin   = x_clock_t::now();
+
+    for (size_t xiter = 0; xiter < xcount; ++xiter)
+    {
+        xht_pool.resize(xthds - 1);
+        xht_pool.resize(xthds);
+    }
+
+    print_result("resize (shrink by 1)", xcount, xusage_begin, xtm_begin);
+    xht_pool.shutdown();
+}
+
+//====================================================================
+
+/**
+ * 用法：wakeup_bench [工作线程数量（默认 4）] [任务对象数量（默认 200000）]
+ */
+int main(int argc, char * argv[])
+{
+    size_t xthds  = (argc > 1) ? static_cast< size_t >(strtoull(argv[1], nullptr, 10)) : 4;
+    size_t xcount = (argc > 2) ? static_cast< size_t >(strtoull(argv[2], nullptr, 10)) : 200000;
+    if (xthds < 2)
+        xthds = 2;
+    if (xcount < 1)
+        xcount = 1;
+
+    printf("threads = %zu\n", xthds);
+
+    bench_burst (xthds, xcount);
+    bench_sparse(xthds, xcount / 10 + 1);
+    bench_resize(xthds, xcount / 100 + 1);
+
+    return 0;
+}
@@ -0,0 +1,1080 @@
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    xparallel.h
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：xparallel.h
+ * 创建日期：2026年10月16日
+ * 文件标识：
+ * 文件摘要：基于 x_threadpool_t 线程池的并行算法（parallel_for 等）。
+ * 
+ * 当前版本：1.1.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加 parallel_reduce、parallel_inclusive_scan/parallel_exclusive_scan 与 parallel_sort。
+ * 
+ * 历史版本：1.0.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加采用惰性二分拆分（lazy binary splitting）的 parallel_for。
+ * </pre>
+ */
+
+#ifndef __XPARALLEL_H__
+#define __XPARALLEL_H__
+
+#include "xthreadpool.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <exception>
+#include <type_traits>
+#include <stdint.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace nsparallel
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** 缓存行的字节数（拆分连续数据时，子区间的边界按其对齐） */
+static constexpr size_t const X_CACHE_LINE_SIZE = 64;
+
+/**
+ * @class x_split_context_t
+ * @brief 惰性二分拆分的执行上下文：[0, xcount) 区间按需拆分，交由线程池的工作线程与调用方共同执行。
+ * @note
+ * <pre>
+ *   执行方每处理完一个粒度（grain）的子区间后，检测是否有空闲的工作线程（多于尚未被领取的子区间），
+ *   有则将剩余区间的后半部分拆分出去，作为任务对象提交至线程池；否则继续执行，不产生额外的任务对象。
+ *   调用方执行完自身的区间后，会回收尚未被工作线程领取的子区间自行执行，因此只需等待正在执行的子区间，
+ *   在工作线程中调用（嵌套并行）也不会死锁。
+ *   上下文对象以引用计数管理：已提交、尚未回收的任务对象各持有一个引用。
+ * </pre>
+ */
+template< typename _Body >
+class x_split_context_t
+{
+    // common data types
+private:
+    /**
+     * @struct x_range_t
+     * @brief  拆分出的子区间；由工作线程或调用方领取（m_xclaimed）后执行，只执行一次。
+     */
+    struct x_range_t
+    {
+        x_range_t(size_t xbegin, size_t xend)
+            : m_xbegin(xbegin)
+            , m_xend(xend)
+            , m_xclaimed(false)
+        {
+
+        }
+
+        size_t              m_xbegin;    ///< 子区间的起始位置
+        size_t              m_xend;      ///< 子区间的结束位置
+        std::atomic< bool > m_xclaimed;  ///< 是否已被领取
+    };
+
+    /**
+     * @struct x_range_task_t
+     * @brief  执行子区间的任务对象。
+     */
+    struct x_range_task_t : public x_threadpool_t::x_task_t
+    {
+        x_range_task_t(x_split_context_t * xcontext_ptr, x_range_t * xrange_ptr)
+            : m_xcontext_ptr(xcontext_ptr)
+            , m_xrange_ptr(xrange_ptr)
+        {
+
+        }
+
+        /** 任务对象未执行就被回收（如 cleanup_task()）时，子区间仍由调用方回收执行 */
+        virtual ~x_range_task_t(void)
+        {
+            m_xcontext_ptr->release();
+        }
+
+        virtual void run(x_threadpool_t::x_running_checker_t * xchecker_ptr) override
+        {
+            m_xcontext_ptr->run_range(m_xrange_ptr);
+        }
+
+        x_split_context_t * m_xcontext_ptr;  ///< 所属的执行上下文
+        x_range_t         * m_xrange_ptr;    ///< 待执行的子区间
+    };
+
+    // constructor/destructor
+private:
+    x_split_context_t(x_threadpool_t & xpool, _Body & xbody, size_t xgrain, size_t xalign, size_t xbias)
+        : m_xpool(xpool)
+        , m_xbody(xbody)
+        , m_xgrain(xgrain)
+        , m_xalign(xalign)
+        , m_xbias(xbias)
+        , m_xref(1)
+        , m_xpending(0)
+        , m_xunclaimed(0)
+        , m_xwaiting(false)
+        , m_xcancelled(false)
+    {
+
+    }
+
+    ~x_split_context_t(void) = default;
+
+    x_split_context_t(const x_split_context_t & xobject) = delete;
+    x_split_context_t & operator=(const x_split_context_t & xobject) = delete;
+
+    // public interfaces
+public:
+    /**********************************************************/
+    /**
+     * @brief 在调用方线程中执行 [0, xcount) 区间，并等待所有拆分出去的子区间执行完成。
+     * 
+     * @param [in ] xpool  : 线程池。
+     * @param [in ] xbody  : 子区间的执行体，以 xbody(xbegin, xend) 方式调用。
+     * @param [in ] xcount : 区间长度。
+     * @param [in ] xgrain : 最小粒度（拆分与检测的单位）。
+     * @param [in ] xalign : 子区间边界的对齐单位（为 1 时，不对齐）。
+     * @param [in ] xbias  : 对齐时的偏移量，即满足 (xbias + 边界) % xalign == 0。
+     * 
+     * @note 执行体抛出的（第一个）异常，在所有子区间结束后，由该接口重新抛出。
+     */
+    static void execute(x_threadpool_t & xpool,
+                        _Body & xbody,
+                        size_t xcount,
+                        size_t xgrain,
+                        size_t xalign,
+                        size_t xbias)
+    {
+        if (0 == xcount)
+        {
+            return;
+        }
+
+        if (xalign < 1)
+        {
+            xalign = 1;
+        }
+
+        // 粒度取 xalign 的整数倍，使得各个子区间占用完整的缓存行
+        if (xgrain < 1)
+        {
+            xgrain = 1;
+        }
+        xgrain = ((xgrain + xalign - 1) / xalign) * xalign;
+
+        x_split_context_t * xcontext_ptr = new x_split_context_t(xpool, xbody, xgrain, xalign, xbias);
+
+        xcontext_ptr->run_caller(xcount);
+
+        std::exception_ptr xexception = std::move(xcontext_ptr->m_xexception);
+        xcontext_ptr->release();
+
+        if (xexception)
+        {
+            std::rethrow_exception(xexception);
+        }
+    }
+
+    // internal invoking
+private:
+    /**********************************************************/
+    /**
+     * @brief 释放引用，降为 0 时，删除上下文对象。
+     */
+    inline void release(void)
+    {
+        if (1 == m_xref.fetch_sub(1))
+        {
+            delete this;
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 是否需要拆分：空闲的工作线程多于尚未被领取的子区间。
+     */
+    inline bool has_demand(void) const
+    {
+        return (m_xpool.idle_count() > m_xunclaimed.load(std::memory_order_relaxed));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将 xpos 向后调整至对齐的边界（不超过 xend）。
+     */
+    inline size_t align_up(size_t xpos, size_t xend) const
+    {
+        if (m_xalign > 1)
+        {
+            size_t xrem = (m_xbias + xpos) % m_xalign;
+            if (0 != xrem)
+            {
+                xpos += (m_xalign - xrem);
+            }
+        }
+
+        return (xpos < xend) ? xpos : xend;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 执行 [xbegin, xend) 区间，期间按需拆分出后半部分。
+     */
+    void run_split(size_t xbegin, size_t xend)
+    {
+        try
+        {
+            while ((xbegin < xend) && !m_xcancelled.load(std::memory_order_relaxed))
+            {
+                if (((xend - xbegin) > m_xgrain) && has_demand())
+                {
+                    size_t xsplit = align_up(xbegin + (xend - xbegin) / 2, xend);
+                    if ((xsplit > xbegin) && (xsplit < xend))
+                    {
+                        spawn_range(xsplit, xend);
+                        xend = xsplit;
+                        continue;
+                    }
+                }
+
+                size_t xstop = align_up(xbegin + m_xgrain, xend);
+                m_xbody(xbegin, xstop);
+                xbegin = xstop;
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard< std::mutex > xautolock(m_lock_ranges);
+            if (!m_xexception)
+            {
+                m_xexception = std::current_exception();
+            }
+            m_xcancelled.store(true);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 拆分出子区间 [xbegin, xend)，并提交至线程池。
+     */
+    void spawn_range(size_t xbegin, size_t xend)
+    {
+        x_range_t * xrange_ptr = nullptr;
+
+        {
+            std::lock_guard< std::mutex > xautolock(m_lock_ranges);
+            m_lst_ranges.emplace_back(xbegin, xend);
+            xrange_ptr = &m_lst_ranges.back();
+            m_lst_unclaimed.push_back(xrange_ptr);
+        }
+
+        // 先递增计数，子区间可能在提交操作返回前即已执行完成
+        m_xpending.fetch_add(1);
+        m_xunclaimed.fetch_add(1);
+        m_xref.fetch_add(1);
+
+        // 调用方正在等待时，唤醒其回收该子区间（工作线程都在忙碌时，可由调用方执行）
+        if (m_xwaiting.load())
+        {
+            nsfutex::X_futex_wake_all(m_xpending);
+        }
+
+        m_xpool.submit_task(new x_range_task_t(this, xrange_ptr));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 领取子区间（只有一方可领取成功）。
+     */
+    inline bool claim_range(x_range_t * xrange_ptr)
+    {
+        if (xrange_ptr->m_xclaimed.exchange(true))
+        {
+            return false;
+        }
+
+        m_xunclaimed.fetch_sub(1);
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作线程执行子区间（已被调用方回收的，则直接忽略）。
+     */
+    void run_range(x_range_t * xrange_ptr)
+    {
+        if (!claim_range(xrange_ptr))
+        {
+            return;
+        }
+
+        run_split(xrange_ptr->m_xbegin, xrange_ptr->m_xend);
+
+        // 调用方只在 m_xwaiting 为 true 时等待（futex 会比较 m_xpending 的值，不会错过通知）
+        m_xpending.fetch_sub(1);
+        if (m_xwaiting.load())
+        {
+            nsfutex::X_futex_wake_all(m_xpending);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 回收一个尚未被工作线程领取的子区间（后拆分的先回收）。
+     */
+    x_range_t * reclaim_range(void)
+    {
+        std::lock_guard< std::mutex > xautolock(m_lock_ranges);
+        while (!m_lst_unclaimed.empty())
+        {
+            x_range_t * xrange_ptr = m_lst_unclaimed.back();
+            m_lst_unclaimed.pop_back();
+            if (claim_range(xrange_ptr))
+            {
+                m_xpending.fetch_sub(1);
+                return xrange_ptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 调用方的执行流程：执行整个区间，回收未被领取的子区间，再等待正在执行的子区间。
+     */
+    void run_caller(size_t xcount)
+    {
+        run_split(0, xcount);
+
+        for (;;)
+        {
+            x_range_t * xrange_ptr = reclaim_range();
+            if (nullptr != xrange_ptr)
+            {
+                run_split(xrange_ptr->m_xbegin, xrange_ptr->m_xend);
+                continue;
+            }
+
+            uint32_t xpending = m_xpending.load();
+            if (0 == xpending)
+            {
+                break;
+            }
+
+            // 执行中的子区间结束（或再拆分出新的子区间）后才会唤醒，届时重新检测
+            m_xwaiting.store(true);
+            nsfutex::X_futex_wait(m_xpending, xpending);
+            m_xwaiting.store(false);
+        }
+    }
+
+    // data members
+private:
+    x_threadpool_t           & m_xpool;          ///< 线程池
+    _Body                    & m_xbody;          ///< 子区间的执行体
+    size_t                     m_xgrain;         ///< 最小粒度
+    size_t                     m_xalign;         ///< 子区间边界的对齐单位
+    size_t                     m_xbias;          ///< 对齐时的偏移量
+
+    std::atomic< size_t >      m_xref;           ///< 引用计数
+    std::atomic< uint32_t >    m_xpending;       ///< 尚未被领取的子区间数量 + 工作线程正在执行的子区间数量
+    std::atomic< size_t >      m_xunclaimed;     ///< 尚未被领取的子区间数量
+    std::atomic< bool >        m_xwaiting;       ///< 调用方是否处于等待状态
+    std::atomic< bool >        m_xcancelled;     ///< 执行体抛出异常后，不再执行剩余的区间
+
+    std::mutex                 m_lock_ranges;    ///< 子区间列表的同步操作锁
+    std::deque< x_range_t >    m_lst_ranges;     ///< 拆分出的所有子区间（deque 保证元素地址不变）
+    std::vector< x_range_t * > m_lst_unclaimed;  ///< 可能尚未被领取的子区间（供调用方回收）
+    std::exception_ptr         m_xexception;     ///< 执行体抛出的第一个异常
+};
+
+/**********************************************************/
+/**
+ * @brief 未指定粒度（xgrain 为 0）时，按工作线程数量估算的默认粒度。
+ */
+inline size_t X_default_grain(x_threadpool_t & xpool, size_t xcount)
+{
+    size_t xgrain = xcount / (8 * (xpool.size() + 1));
+    return (xgrain < 1) ? 1 : xgrain;
+}
+
+/**********************************************************/
+/**
+ * @brief 计算指针所指的连续数据按缓存行对齐时的对齐单位与偏移量（参看 x_split_context_t::execute()）。
+ */
+template< typename _Ty >
+inline void X_cache_align(const _Ty * xfirst, size_t & xalign, size_t & xbias)
+{
+    uintptr_t xaddr = reinterpret_cast< uintptr_t >(xfirst);
+
+    // 元素大小可整除缓存行时，才可按元素个数对齐
+    if ((sizeof(_Ty) < X_CACHE_LINE_SIZE) &&
+        (0 == (X_CACHE_LINE_SIZE % sizeof(_Ty))) &&
+        (0 == (xaddr % sizeof(_Ty))))
+    {
+        xalign = X_CACHE_LINE_SIZE / sizeof(_Ty);
+        xbias  = (xaddr % X_CACHE_LINE_SIZE) / sizeof(_Ty);
+    }
+    else
+    {
+        xalign = 1;
+        xbias  = 0;
+    }
+}
+
+/**
+ * @struct x_accumulator_t
+ * @brief  归约操作中，各个工作线程私有的局部累加值（按缓存行填充，避免伪共享）。
+ */
+template< typename _Ty >
+struct alignas(X_CACHE_LINE_SIZE) x_accumulator_t
+{
+    explicit x_accumulator_t(const _Ty & xvalue) : m_xvalue(xvalue), m_xvalid(false) { }
+
+    _Ty  m_xvalue;  ///< 局部累加值
+    bool m_xvalid;  ///< 是否已累加过数据
+};
+
+/**********************************************************/
+/**
+ * @brief 并行归约 [0, xcount) 区间。
+ *
+ * @param [in ] xpool    : 线程池。
+ * @param [in ] xcount   : 区间长度。
+ * @param [in ] xgrain   : 最小粒度。
+ * @param [in ] xalign   : 子区间边界的对齐单位。
+ * @param [in ] xbias    : 对齐时的偏移量。
+ * @param [in ] xinit    : 初始值（也用于构造各个局部累加值，但不参与其计算）。
+ * @param [in ] xchunk   : 子区间的归约操作，以 _Ty xchunk(xbegin, xend) 方式调用。
+ * @param [in ] xcombine : 合并两个归约值的操作，以 _Ty xcombine(xleft, xright) 方式调用。
+ *
+ * @note
+ * <pre>
+ *   各个子区间的归约值，按 x_running_checker_t::thread_index() 合并至所在工作线程的局部累加值，
+ *   不加锁；调用方（或 resize() 后新增的工作线程）则加锁合并至额外的累加值。
+ *   最后依次合并所有的局部累加值，因此 xcombine 需满足结合律与交换律。
+ * </pre>
+ */
+template< typename _Ty, typename _Chunk, typename _Combine >
+_Ty X_reduce(x_threadpool_t & xpool,
+             size_t xcount,
+             size_t xgrain,
+             size_t xalign,
+             size_t xbias,
+             const _Ty & xinit,
+             _Chunk & xchunk,
+             _Combine & xcombine)
+{
+    size_t xslots = xpool.size();
+
+    std::vector< x_accumulator_t< _Ty > > xaccumulators(xslots, x_accumulator_t< _Ty >(xinit));
+    x_accumulator_t< _Ty > xextra(xinit);
+    std::mutex xlock_extra;
+
+    auto xmerge = [&xcombine](x_accumulator_t< _Ty > & xaccumulator, _Ty && xvalue) -> void
+    {
+        if (xaccumulator.m_xvalid)
+        {
+            xaccumulator.m_xvalue = xcombine(std::move(xaccumulator.m_xvalue), std::move(xvalue));
+        }
+        else
+        {
+            xaccumulator.m_xvalue = std::move(xvalue);
+            xaccumulator.m_xvalid = true;
+        }
+    };
+
+    auto xbody = [&](size_t xbegin, size_t xend) -> void
+    {
+        _Ty xvalue = xchunk(xbegin, xend);
+
+        const x_threadpool_t::x_running_checker_t * xchecker_ptr = xpool.current_checker();
+        if ((nullptr != xchecker_ptr) && (xchecker_ptr->thread_index() < xslots))
+        {
+            xmerge(xaccumulators[xchecker_ptr->thread_index()], std::move(xvalue));
+        }
+        else
+        {
+            std::lock_guard< std::mutex > xautolock(xlock_extra);
+            xmerge(xextra, std::move(xvalue));
+        }
+    };
+
+    x_split_context_t< decltype(xbody) >::execute(xpool, xbody, xcount, xgrain, xalign, xbias);
+
+    _Ty xresult = xinit;
+    if (xextra.m_xvalid)
+    {
+        xresult = xcombine(std::move(xresult), std::move(xextra.m_xvalue));
+    }
+
+    for (x_accumulator_t< _Ty > & xaccumulator : xaccumulators)
+    {
+        if (xaccumulator.m_xvalid)
+        {
+            xresult = xcombine(std::move(xresult), std::move(xaccumulator.m_xvalue));
+        }
+    }
+
+    return xresult;
+}
+
+/**********************************************************/
+/**
+ * @brief 两趟（two-pass）分块的并行前缀和。
+ *
+ * @param [in ] xpool      : 线程池。
+ * @param [in ] xfirst     : 输入区间的起始位置。
+ * @param [in ] xlast      : 输入区间的结束位置。
+ * @param [out] xdest      : 输出区间的起始位置（可与 xfirst 相同，即原地操作）。
+ * @param [in ] xop        : 二元操作（需满足结合律）。
+ * @param [in ] xinit_ptr  : 初始值（为 nullptr 时，表示无初始值；此时 xexclusive 须为 false）。
+ * @param [in ] xexclusive : 是否为不包含当前元素的前缀和。
+ *
+ * @note
+ * <pre>
+ *   第一趟并行计算各个数据块（最后一块除外）的归约值，再顺序求出各个数据块的起始偏移值；
+ *   第二趟并行地以起始偏移值对各个数据块进行前缀和操作。数据块按缓存行对齐。
+ * </pre>
+ */
+template< typename _Ty, typename _Op >
+void X_scan(x_threadpool_t & xpool,
+            const _Ty * xfirst,
+            const _Ty * xlast,
+            _Ty * xdest,
+            _Op & xop,
+            const _Ty * xinit_ptr,
+            bool xexclusive)
+{
+    if (!(xfirst < xlast))
+    {
+        return;
+    }
+
+    size_t xcount = static_cast< size_t >(xlast - xfirst);
+
+    // 数据块的大小：每个执行线程约 4 块，且不小于 4096 个元素，按缓存行取整
+    size_t xalign = 1;
+    size_t xbias  = 0;
+    X_cache_align(xdest, xalign, xbias);
+
+    size_t xblock = xcount / (4 * (xpool.size() + 1));
+    if (xblock < 4096)
+    {
+        xblock = 4096;
+    }
+    xblock = ((xblock + xalign - 1) / xalign) * xalign;
+
+    // 首个数据块截止至对齐的边界，使得后续数据块的起始位置都按缓存行对齐
+    size_t xhead = xblock - ((xbias + xblock) % xalign);
+    if (xhead > xcount)
+    {
+        xhead = xcount;
+    }
+
+    size_t xblocks = 1 + (xcount - xhead + xblock - 1) / xblock;
+
+    auto xblock_begin = [xhead, xblock](size_t xindex) -> size_t
+    {
+        return (0 == xindex) ? 0 : (xhead + (xindex - 1) * xblock);
+    };
+
+    auto xblock_end = [xhead, xblock, xcount](size_t xindex) -> size_t
+    {
+        size_t xend = xhead + xindex * xblock;
+        return (xend < xcount) ? xend : xcount;
+    };
+
+    // 第一趟：各个数据块（最后一块除外）的归约值
+    std::vector< _Ty > xsums(xblocks, *xfirst);
+    auto xsum_body = [&](size_t xbegin, size_t xend) -> void
+    {
+        for (size_t xindex = xbegin; xindex < xend; ++xindex)
+        {
+            const _Ty * xiter = xfirst + xblock_begin(xindex);
+            const _Ty * xstop = xfirst + xblock_end(xindex);
+
+            _Ty xsum = *xiter;
+            while (++xiter != xstop)
+            {
+                xsum = xop(std::move(xsum), *xiter);
+            }
+
+            xsums[xindex] = std::move(xsum);
+        }
+    };
+
+    x_split_context_t< decltype(xsum_body) >::execute(xpool, xsum_body, xblocks - 1, 1, 1, 0);
+
+    // 各个数据块的起始偏移值（xsums[i] 改存第 i 块之前的累加值，首块无初始值时无偏移值）
+    bool xhas_offset = (nullptr != xinit_ptr);
+    _Ty  xoffset = xhas_offset ? *xinit_ptr : *xfirst;
+    for (size_t xindex = 0; xindex < xblocks; ++xindex)
+    {
+        _Ty xsum = std::move(xsums[xindex]);
+        xsums[xindex] = xoffset;
+        if (xindex + 1 < xblocks)
+        {
+            xoffset = xhas_offset ? xop(std::move(xoffset), std::move(xsum)) : std::move(xsum);
+            xhas_offset = true;
+        }
+    }
+
+    // 第二趟：以起始偏移值对各个数据块进行前缀和操作
+    bool xfirst_offset = (nullptr != xinit_ptr);
+    auto xscan_body = [&](size_t xbegin, size_t xend) -> void
+    {
+        for (size_t xindex = xbegin; xindex < xend; ++xindex)
+        {
+            size_t xiter = xblock_begin(xindex);
+            size_t xstop = xblock_end(xindex);
+
+            bool xvalid = ((0 != xindex) || xfirst_offset);
+            _Ty  xacc   = xsums[xindex];
+
+            for (; xiter < xstop; ++xiter)
+            {
+                // 先取出输入值，以支持原地操作
+                _Ty xvalue = xfirst[xiter];
+                if (xexclusive)
+                {
+                    xdest[xiter] = xacc;
+                    xacc = xop(std::move(xacc), std::move(xvalue));
+                }
+                else
+                {
+                    xacc = xvalid ? xop(std::move(xacc), std::move(xvalue)) : std::move(xvalue);
+                    xdest[xiter] = xacc;
+                }
+                xvalid = true;
+            }
+        }
+    };
+
+    x_split_context_t< decltype(xscan_body) >::execute(xpool, xscan_body, xblocks, 1, 1, 0);
+}
+
+/**********************************************************/
+/**
+ * @brief 按对角线（merge path）划分两个有序区间的合并位置：
+ *        返回 xa 中参与合并结果前 xdiag 个元素的元素个数（相等时，xa 的元素在前）。
+ */
+template< typename _Ty, typename _Compare >
+size_t X_merge_path(const _Ty * xa, size_t xa_size,
+                    const _Ty * xb, size_t xb_size,
+                    size_t xdiag, _Compare & xcomp)
+{
+    size_t xlow  = (xdiag > xb_size) ? (xdiag - xb_size) : 0;
+    size_t xhigh = (xdiag < xa_size) ? xdiag : xa_size;
+
+    while (xlow < xhigh)
+    {
+        size_t xmid = xlow + (xhigh - xlow) / 2;
+        if (xcomp(xb[xdiag - xmid - 1], xa[xmid]))
+            xhigh = xmid;
+        else
+            xlow = xmid + 1;
+    }
+
+    return xlow;
+}
+
+/**********************************************************/
+/**
+ * @brief 并行归并排序（参看 parallel_sort() 接口的说明）。
+ */
+template< typename _Ty, typename _Compare >
+void X_sort(x_threadpool_t & xpool, _Ty * xfirst, _Ty * xlast, _Compare & xcomp)
+{
+    size_t xcount = (xfirst < xlast) ? static_cast< size_t >(xlast - xfirst) : 0;
+
+    // 数据量较小或没有工作线程时，直接顺序排序
+    size_t xthreads = xpool.size() + 1;
+    if ((xcount < 16384) || (xthreads < 2))
+    {
+        std::sort(xfirst, xlast, xcomp);
+        return;
+    }
+
+    // 初始有序段的数量：不少于执行线程数量的 2 的幂
+    size_t xruns = 1;
+    while ((xruns < 2 * xthreads) && ((xcount / (xruns * 2)) >= 4096))
+    {
+        xruns *= 2;
+    }
+
+    auto xrun_begin = [xcount, xruns](size_t xindex) -> size_t
+    {
+        return (xindex >= xruns) ? xcount : (xcount / xruns) * xindex;
+    };
+
+    // 各个有序段分别排序
+    auto xsort_body = [&](size_t xbegin, size_t xend) -> void
+    {
+        for (size_t xindex = xbegin; xindex < xend; ++xindex)
+        {
+            std::sort(xfirst + xrun_begin(xindex), xfirst + xrun_begin(xindex + 1), xcomp);
+        }
+    };
+
+    x_split_context_t< decltype(xsort_body) >::execute(xpool, xsort_body, xruns, 1, 1, 0);
+
+    // 逐轮两两归并（在原区间与缓存区间之间交替），
+    // 每轮按对角线将所有的归并操作划分为相同大小的片段，保证最后几轮也可并行执行
+    std::vector< _Ty > xbuffer(xcount);
+    _Ty * xsrc = xfirst;
+    _Ty * xdst = xbuffer.data();
+
+    size_t xpieces = 4 * xthreads;
+    std::vector< size_t > xsplits;
+
+    for (size_t xwidth = 1; xwidth < xruns; xwidth *= 2)
+    {
+        size_t xpairs    = xruns / (2 * xwidth);
+        size_t xsegments = (xpieces + xpairs - 1) / xpairs;
+
+        // 先划分好所有片段的合并位置（归并过程会移走源数据，不可与其并行划分）
+        xsplits.resize(xpairs * (xsegments + 1));
+        for (size_t xpair = 0; xpair < xpairs; ++xpair)
+        {
+            size_t xa_pos  = xrun_begin(2 * xpair * xwidth);
+            size_t xb_pos  = xrun_begin((2 * xpair + 1) * xwidth);
+            size_t xb_end  = xrun_begin((2 * xpair + 2) * xwidth);
+            size_t xa_size = xb_pos - xa_pos;
+            size_t xb_size = xb_end - xb_pos;
+
+            for (size_t xsegment = 0; xsegment <= xsegments; ++xsegment)
+            {
+                xsplits[xpair * (xsegments + 1) + xsegment] =
+                    X_merge_path(xsrc + xa_pos, xa_size, xsrc + xb_pos, xb_size,
+                                 (xa_size + xb_size) * xsegment / xsegments, xcomp);
+            }
+        }
+
+        auto xmerge_body = [&](size_t xbegin, size_t xend) -> void
+        {
+            for (size_t xindex = xbegin; xindex < xend; ++xindex)
+            {
+                size_t xpair    = xindex / xsegments;
+                size_t xsegment = xindex % xsegments;
+
+                size_t xa_pos  = xrun_begin(2 * xpair * xwidth);
+                size_t xb_pos  = xrun_begin((2 * xpair + 1) * xwidth);
+                size_t xb_end  = xrun_begin((2 * xpair + 2) * xwidth);
+                size_t xtotal  = xb_end - xa_pos;
+
+                size_t xdiag_first = xtotal * xsegment / xsegments;
+                size_t xdiag_last  = xtotal * (xsegment + 1) / xsegments;
+
+                size_t xa_first = xsplits[xpair * (xsegments + 1) + xsegment];
+                size_t xa_last  = xsplits[xpair * (xsegments + 1) + xsegment + 1];
+
+                std::merge(std::make_move_iterator(xsrc + xa_pos + xa_first),
+                           std::make_move_iterator(xsrc + xa_pos + xa_last),
+                           std::make_move_iterator(xsrc + xb_pos + (xdiag_first - xa_first)),
+                           std::make_move_iterator(xsrc + xb_pos + (xdiag_last  - xa_last )),
+                           xdst + xa_pos + xdiag_first,
+                           xcomp);
+            }
+        };
+
+        x_split_context_t< decltype(xmerge_body) >::execute(xpool, xmerge_body, xpairs * xsegments, 1, 1, 0);
+
+        std::swap(xsrc, xdst);
+    }
+
+    // 结果位于缓存区间时，移回原区间
+    if (xsrc != xfirst)
+    {
+        _Ty * xbuffer_ptr = xsrc;
+        auto xmove_body = [xbuffer_ptr, xfirst](size_t xbegin, size_t xend) -> void
+        {
+            std::move(xbuffer_ptr + xbegin, xbuffer_ptr + xend, xfirst + xbegin);
+        };
+
+        x_split_context_t< decltype(xmove_body) >::execute(xpool, xmove_body, xcount, 4096, 1, 0);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace nsparallel
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**********************************************************/
+/**
+ * @brief 并行执行 xfunc(i)，i 取值区间为 [xbegin, xend)。
+ * 
+ * @param [in ] xpool  : 线程池（调用方线程也参与执行）。
+ * @param [in ] xbegin : 起始索引。
+ * @param [in ] xend   : 结束索引。
+ * @param [in ] xgrain : 最小粒度，即连续执行而不拆分的最少迭代次数（为 0 时，按工作线程数量估算）。
+ * @param [in ] xfunc  : 迭代的执行体。
+ * 
+ * @note
+ * <pre>
+ *   采用惰性二分拆分：只在有空闲的工作线程时，才拆分出剩余区间的后半部分，
+ *   各次迭代的耗时不均匀时，也能保持各个工作线程的负载均衡。
+ *   xfunc 抛出异常时，剩余的迭代不再执行，并由该接口重新抛出（第一个）异常。
+ *   对连续内存的数据进行迭代时，可使用指针版本的 parallel_for()，其子区间按缓存行对齐。
+ * </pre>
+ */
+template< typename _Index, typename _Func,
+          typename = typename std::enable_if< std::is_integral< _Index >::value >::type >
+void parallel_for(x_threadpool_t & xpool, _Index xbegin, _Index xend, size_t xgrain, _Func && xfunc)
+{
+    if (!(xbegin < xend))
+    {
+        return;
+    }
+
+    size_t xcount = static_cast< size_t >(xend - xbegin);
+
+    auto xbody = [xbegin, &xfunc](size_t xfirst, size_t xlast) -> void
+    {
+        for (size_t xiter = xfirst; xiter < xlast; ++xiter)
+        {
+            xfunc(static_cast< _Index >(xbegin + static_cast< _Index >(xiter)));
+        }
+    };
+
+    nsparallel::x_split_context_t< decltype(xbody) >::execute(
+        xpool,
+        xbody,
+        xcount,
+        (0 != xgrain) ? xgrain : nsparallel::X_default_grain(xpool, xcount),
+        1,
+        0);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行执行 xfunc(*iter)，iter 取值区间为 [xfirst, xlast)（连续内存的数据）。
+ * @note
+ * <pre>
+ *   子区间的边界按缓存行（X_CACHE_LINE_SIZE）对齐，粒度也取整为缓存行的整数倍，
+ *   避免不同的线程写入同一缓存行（伪共享）；其他说明参看索引版本的 parallel_for()。
+ * </pre>
+ */
+template< typename _Ty, typename _Func >
+void parallel_for(x_threadpool_t & xpool, _Ty * xfirst, _Ty * xlast, size_t xgrain, _Func && xfunc)
+{
+    if (!(xfirst < xlast))
+    {
+        return;
+    }
+
+    size_t xcount = static_cast< size_t >(xlast - xfirst);
+
+    size_t xalign = 1;
+    size_t xbias  = 0;
+    nsparallel::X_cache_align(xfirst, xalign, xbias);
+
+    auto xbody = [xfirst, &xfunc](size_t xbegin, size_t xend) -> void
+    {
+        for (_Ty * xiter = xfirst + xbegin; xiter != xfirst + xend; ++xiter)
+        {
+            xfunc(*xiter);
+        }
+    };
+
+    nsparallel::x_split_context_t< decltype(xbody) >::execute(
+        xpool,
+        xbody,
+        xcount,
+        (0 != xgrain) ? xgrain : nsparallel::X_default_grain(xpool, xcount),
+        xalign,
+        xbias);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行归约：依次以 xacc = xfunc(xacc, i) 累加 [xbegin, xend) 区间，返回所有累加值的合并结果。
+ *
+ * @param [in ] xpool     : 线程池（调用方线程也参与执行）。
+ * @param [in ] xbegin    : 起始索引。
+ * @param [in ] xend      : 结束索引。
+ * @param [in ] xgrain    : 最小粒度（为 0 时，按工作线程数量估算）。
+ * @param [in ] xidentity : 单位元（各个子区间累加的初始值）。
+ * @param [in ] xfunc     : 累加操作，以 _Ty xfunc(_Ty xacc, _Index i) 方式调用。
+ * @param [in ] xcombine  : 合并操作，以 _Ty xcombine(_Ty xleft, _Ty xright) 方式调用（需满足结合律与交换律）。
+ *
+ * @note
+ * <pre>
+ *   各个子区间的累加值，合并至所在工作线程私有的局部累加值
+ *   （按 x_running_checker_t::thread_index() 索引），最后再合并所有的局部累加值。
+ * </pre>
+ */
+template< typename _Index, typename _Ty, typename _Func, typename _Combine,
+          typename = typename std::enable_if< std::is_integral< _Index >::value >::type >
+_Ty parallel_reduce(x_threadpool_t & xpool,
+                    _Index xbegin,
+                    _Index xend,
+                    size_t xgrain,
+                    _Ty xidentity,
+                    _Func && xfunc,
+                    _Combine && xcombine)
+{
+    if (!(xbegin < xend))
+    {
+        return xidentity;
+    }
+
+    size_t xcount = static_cast< size_t >(xend - xbegin);
+
+    auto xchunk = [xbegin, &xidentity, &xfunc](size_t xfirst, size_t xlast) -> _Ty
+    {
+        _Ty xacc = xidentity;
+        for (size_t xiter = xfirst; xiter < xlast; ++xiter)
+        {
+            xacc = xfunc(std::move(xacc), static_cast< _Index >(xbegin + static_cast< _Index >(xiter)));
+        }
+        return xacc;
+    };
+
+    return nsparallel::X_reduce(
+        xpool,
+        xcount,
+        (0 != xgrain) ? xgrain : nsparallel::X_default_grain(xpool, xcount),
+        1,
+        0,
+        xidentity,
+        xchunk,
+        xcombine);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行归约 [xfirst, xlast) 区间的连续数据：返回 xinit 与所有元素经 xop 合并的结果（同 std::reduce）。
+ * @note  xop 需满足结合律与交换律；其他说明参看索引版本的 parallel_reduce()。
+ */
+template< typename _Vt, typename _Ty, typename _Op >
+_Ty parallel_reduce(x_threadpool_t & xpool,
+                    const _Vt * xfirst,
+                    const _Vt * xlast,
+                    size_t xgrain,
+                    _Ty xinit,
+                    _Op && xop)
+{
+    if (!(xfirst < xlast))
+    {
+        return xinit;
+    }
+
+    size_t xcount = static_cast< size_t >(xlast - xfirst);
+
+    size_t xalign = 1;
+    size_t xbias  = 0;
+    nsparallel::X_cache_align(xfirst, xalign, xbias);
+
+    auto xchunk = [xfirst, &xop](size_t xbegin, size_t xend) -> _Ty
+    {
+        const _Vt * xiter = xfirst + xbegin;
+        _Ty xacc = static_cast< _Ty >(*xiter);
+        while (++xiter != xfirst + xend)
+        {
+            xacc = xop(std::move(xacc), *xiter);
+        }
+        return xacc;
+    };
+
+    return nsparallel::X_reduce(
+        xpool,
+        xcount,
+        (0 != xgrain) ? xgrain : nsparallel::X_default_grain(xpool, xcount),
+        xalign,
+        xbias,
+        xinit,
+        xchunk,
+        xop);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行的包含式前缀和：xdest[i] = xfirst[0] op ... op xfirst[i]（同 std::inclusive_scan）。
+ * @note
+ * <pre>
+ *   两趟分块计算（先求各个数据块的归约值，再以其偏移值对各个数据块进行前缀和），
+ *   xop 需满足结合律；xdest 可与 xfirst 相同（原地操作），返回输出区间的结束位置。
+ * </pre>
+ */
+template< typename _Ty, typename _Op = std::plus< _Ty > >
+_Ty * parallel_inclusive_scan(x_threadpool_t & xpool,
+                              const _Ty * xfirst,
+                              const _Ty * xlast,
+                              _Ty * xdest,
+                              _Op xop = _Op())
+{
+    nsparallel::X_scan(xpool, xfirst, xlast, xdest, xop, static_cast< const _Ty * >(nullptr), false);
+    return xdest + (xlast - xfirst);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行的排除式前缀和：xdest[0] = xinit，xdest[i] = xinit op xfirst[0] op ... op xfirst[i - 1]
+ *        （同 std::exclusive_scan；参看 parallel_inclusive_scan() 的说明）。
+ */
+template< typename _Ty, typename _Op = std::plus< _Ty > >
+_Ty * parallel_exclusive_scan(x_threadpool_t & xpool,
+                              const _Ty * xfirst,
+                              const _Ty * xlast,
+                              _Ty * xdest,
+                              _Ty xinit,
+                              _Op xop = _Op())
+{
+    nsparallel::X_scan(xpool, xfirst, xlast, xdest, xop, &xinit, true);
+    return xdest + (xlast - xfirst);
+}
+
+/**********************************************************/
+/**
+ * @brief 并行排序 [xfirst, xlast) 区间的连续数据（不稳定排序，同 std::sort）。
+ * @note
+ * <pre>
+ *   先将区间切分为若干段（不少于执行线程数量的 2 倍），各段并行地 std::sort，
+ *   再逐轮两两归并；每轮按对角线（merge path）将归并操作划分为相同大小的片段并行执行。
+ *   需要与区间等长的缓存（_Ty 须可默认构造与移动）；数据量较小时，直接调用 std::sort。
+ * </pre>
+ */
+template< typename _Ty, typename _Compare = std::less< _Ty > >
+void parallel_sort(x_threadpool_t & xpool, _Ty * xfirst, _Ty * xlast, _Compare xcomp = _Compare())
+{
+    nsparallel::X_sort(xpool, xfirst, xlast, xcomp);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // __XPARALLEL_H__
@@ -1,1191 +1,9453 @@
-﻿/**
- * The MIT License (MIT)
- * Copyright (c) 2019, Gaaagaa All rights reserved.
- * 
- * Permission is hereby granted, free of charge, to any person obtaining a copy of
- * this software and associated documentation files (the "Software"), to deal in
- * the Software without restriction, including without limitation the rights to
- * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
- * of the Software, and to permit persons to whom the Software is furnished to do
- * so, subject to the following conditions:
- * 
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- * 
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
- * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
- * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
- * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
- * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
- */
-
-/**
- * @file    xthreadpool.h
- * <pre>
- * Copyright (c) 2019, Gaaagaa All rights reserved.
- * 
- * 文件名称：xthreadpool.h
- * 创建日期：2018年12月12日
- * 文件标识：
- * 文件摘要：使用 C++11 新标准 thread 线程对象实现的线程池类。
- * 
- * 当前版本：1.2.0.1
- * 作    者：
- * 完成日期：2019年10月13日
- * 版本摘要：改用原子操作的整数计数变量，判断当前是否可提取待执行的任务对象。
- * 
- * 历史版本：1.2.0.0
- * 作    者：
- * 完成日期：2019年01月18日
- * 版本摘要：任务对象增加挂起判断接口，解决“某一类任务对象在线程池中可顺序执行”的问题。
- * 
- * 历史版本：1.1.0.0
- * 作    者：
- * 完成日期：2018年12月16日
- * 版本摘要：增加模板参数列表的类型索引功能（请参看 X_type_index 的设计），
- *          使得 x_threadpool_t::submit_task_ex() 接口的 xargs 参数列表
- *          中的 x_running_checker_t::x_holder_t 类型参数可放置在任意位置。
- * 
- * 历史版本：1.0.0.0
- * 原作者  ：
- * 完成日期：2018年12月12日
- * 版本摘要：
- * </pre>
- */
-
-#ifndef __XTHREADPOOL_H__
-#define __XTHREADPOOL_H__
-
-#include <list>
-#include <functional>
-#include <utility>
-#include <type_traits>
-
-#include <chrono>
-#include <thread>
-#include <atomic>
-#include <mutex>
-#include <condition_variable>
-
-////////////////////////////////////////////////////////////////////////////////
-
-/**
- * @brief 命名空间内定义一些 std::tuple 相关操作的辅助接口。
- */
-namespace nstuple
-{
-
-////////////////////////////////////////////////////////////////////////////////
-
-/**
- * Stores a tuple of indices. Used by bind() to extract the elements in a tuple. 
- */
-template< size_t... _Indexes >
-struct X_Index_tuple
-{
-
-};
-
-/// Builds an X_Index_tuple< 0, 1, 2, ..., _Num - 1 >.
-template< size_t _Num, typename _Tuple = X_Index_tuple<> >
-struct X_Build_index_tuple;
-
-template< size_t _Num, size_t... _Indexes >
-struct X_Build_index_tuple< _Num, X_Index_tuple< _Indexes... > >
-    : X_Build_index_tuple< _Num - 1, X_Index_tuple< _Indexes..., sizeof...(_Indexes) > >
-{
-
-};
-
-template< size_t... _Indexes >
-struct X_Build_index_tuple< 0, X_Index_tuple< _Indexes... > >
-{
-    typedef X_Index_tuple< _Indexes... > __type;
-};
-
-/**
- * @brief 
- * <pre>
- *   本区段的代码改写自 gcc 8.2.0 版内的 STL 源码（functional 文件）。
- *   主要用于 std::tuple 对象的参数解包操作，可参看如下示例代码。
- * </pre>
- * 
- * @code
- * <pre>
- * #include <tuple>
- * #include <iostream>
- * 
- * void call_test(int v1, float v2, double v3)
- * {
- *     std::cout << "(v1, v2, v3) : "
- *               << "("  << v1
- *               << ", " << v2
- *               << ", " << v3
- *               << ")"  << std::endl;
- * }
- * 
- * using X_Tuple   = std::tuple< int, float, double >;
- * using X_Indices = nstuple::X_Build_index_tuple< std::tuple_size< X_Tuple >::value >::__type;
- * 
- * template< size_t... _Ind >
- * void _S_Invoke(X_Tuple && xtuple, nstuple::X_Index_tuple< _Ind... >)
- * {
- *     call_test(std::get< _Ind >(std::move(xtuple))...);
- * }
- * 
- * int main(int argc, char * argv[])
- * {
- *     X_Tuple xtuple{ 1234, 1.234F, 1.234 };
- *     _S_Invoke(std::forward< X_Tuple >(xtuple), X_Indices());
- * 
- *     return 0;
- * }
- * </pre>
- * @endcode
- */
-
-////////////////////////////////////////////////////////////////////////////////
-
-/**
- * @struct X_check
- * @brief  协助 X_tuple_has_type() 进行类型检查。
- */
-template< bool... >
-struct X_type_check
-{
-
-};
-
-/**
- * @brief 判断 tuple 对象内是否包含某个数据类型。
- * 
- * @param[in ] _Fy    : 待判断的数据类型。
- * @param[in ] _Ty... : tuple 的参数列表。
- * 
- */
-template< typename _Fy, typename... _Ty >
-constexpr bool X_tuple_has_type(const std::tuple< _Ty... > &)
-{
-    return !std::is_same< X_type_check< false, std::is_same< _Fy, _Ty >::value... >,
-                          X_type_check< std::is_same< _Fy, _Ty >::value..., false > >::value;
-}
-
-/**
- * @brief X_tuple_has_type() 接口的测试代码如下所示。
- * @code
- * <pre>
- * #include <type_traits>
- * #include <tuple>
- * #include <iostream>
- * 
- * int main(int argc, char * argv[])
- * {
- *     std::cout << std::boolalpha;
- *     std::cout << nstuple::X_tuple_has_type< int    >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
- *     std::cout << nstuple::X_tuple_has_type< char   >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
- *     std::cout << nstuple::X_tuple_has_type< double >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
- *     std::cout << nstuple::X_tuple_has_type< float  >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
- *     std::cout << nstuple::X_tuple_has_type< void   >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
- * 
- *     return 0;
- * }
- * </pre>
- * @endcode
- */
-
-////////////////////////////////////////////////////////////////////////////////
-
-/** X_type_count 的前置声明 */
-template< typename _Fy, typename... _Ty >
-struct X_type_count;
-
-/**
- * @struct X_type_count< _Fy, _Hy, _Ty... >
- * @brief  递归的数据类型统计类。
- */
-template< typename _Fy, typename _Hy, typename... _Ty >
-struct X_type_count< _Fy, _Hy, _Ty... >
-{
-    enum { value = (int)(std::is_same< _Fy, _Hy >::value) + X_type_count< _Fy, _Ty... >::value };
-};
-
-/**
- * @struct X_type_count< _Fy >
- * @brief  终止递归的数据类型统计类。
- */
-template< typename _Fy >
-struct X_type_count< _Fy >
-{
-    enum { value = 0 };
-};
-
-/**
- * @brief 统计 tuple 对象内某个数据类型的数量。
- */
-template< typename _Fy, typename... _Ty >
-constexpr size_t X_tuple_type_count(const std::tuple< _Ty... > &)
-{
-    return X_type_count< _Fy, _Ty... >::value;
-}
-
-/**
- * @brief X_tuple_type_count() 接口的测试代码如下所示。
- * @code
- * <pre>
- * #include <type_traits>
- * #include <tuple>
- * #include <iostream>
- * 
- * int main(int argc, char * argv[])
- * {
- *     std::cout << nstuple::X_type_count< int, int, int, char, char, double >::value << std::endl;
- * 
- *     std::cout << nstuple::X_tuple_type_count< int    >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
- *     std::cout << nstuple::X_tuple_type_count< char   >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
- *     std::cout << nstuple::X_tuple_type_count< double >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
- *     std::cout << nstuple::X_tuple_type_count< float  >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
- *     std::cout << nstuple::X_tuple_type_count< void * >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
- * 
- *     return 0;
- * }
- * </pre>
- * @endcode
- */
-
-////////////////////////////////////////////////////////////////////////////////
-
-/**
- * @struct X_type_index
- * @brief  类型索引模板：从变参列表中查找指定类型的索引位置（以 < _Fy, _Indx > 结对进行判断）。
- * 
- * @param[in ] _Fy    : 待查找类型。
- * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
- * @param[in ] _Ty... : 变参列表。
- */
-template< typename _Fy, size_t _Indx, typename... _Ty >
-struct X_type_index;
-
-/**
- * @struct X_type_index_iter
- * @brief  协助 X_type_index 进行 变参列表 递归遍历操作。
- * 
- * @param[in ] _Vy    : 模板特化的参数；
- *                      为 true  时，转向 X_type_index_jter 继续进行递归遍历；
- *                      为 false 时，转回 X_type_index 继续进行递归遍历。
- * @param[in ] _Fy    : 待查找类型。
- * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
- * @param[in ] _Ty... : 变参列表。
- */
-template< bool _Vy, typename _Fy, size_t _Indx, typename... _Ty >
-struct X_type_index_iter;
-
-/**
- * @struct X_type_index_jter
- * @brief  协助 X_type_index_iter 进行 变参列表 递归遍历操作。
- * 
- * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）；
- *                      为 0 时，终止递归下降，否则转回 X_type_index 继续进行递归遍历。
- * @param[in ] _Fy    : 待查找类型。
- * @param[in ] _Ty... : 变参列表。
- */
-template< size_t _Indx, typename _Fy, typename... _Ty >
-struct X_type_index_jter;
-
-/**
- * @brief 终止 X_type_index_jter 递归下降。
- */
-template< typename _Fy, typename... _Ty >
-struct X_type_index_jter< 0, _Fy, _Ty... >
-{
-    enum { value = 0 };
-};
-
-/**
- * @brief 转回 X_type_index 继续进行递归下降遍历。
- */
-template< size_t _Indx, typename _Fy, typename... _Ty >
-struct X_type_index_jter
-{
-    enum { value = 1 + X_type_index< _Fy, _Indx - 1, _Ty... >::value };
-};
-
-/**
- * @brief 转向 X_type_index_jter 继续进行递归遍历。
- */
-template< typename _Fy, size_t _Indx, typename... _Ty >
-struct X_type_index_iter< true, _Fy, _Indx, _Ty... >
-{
-    enum { value = 0 + X_type_index_jter< _Indx, _Fy, _Ty...>::value };
-};
-
-/**
- * @brief 转回 X_type_index 继续进行递归遍历。
- */
-template< typename _Fy, size_t _Indx, typename... _Ty >
-struct X_type_index_iter< false, _Fy, _Indx, _Ty... >
-{
-    enum { value = 1 + X_type_index< _Fy, _Indx, _Ty... >::value };
-};
-
-/**
- * @brief X_type_index 递归遍历入口。
- */
-template< typename _Fy, size_t _Indx, typename _Hy, typename... _Ty >
-struct X_type_index< _Fy, _Indx, _Hy, _Ty... >
-{
-    enum { value = X_type_index_iter< std::is_same< _Fy, _Hy >::value, _Fy, _Indx, _Ty... >::value };
-};
-
-/**
- * @brief X_type_index 递归遍历终结位置。
- */
-template< typename _Fy, size_t _Indx >
-struct X_type_index< _Fy, _Indx >
-{
-    enum { value = 0x1FFFFFFF };
-};
-
-/**
- * @brief 从 tuple 的变参列表中查找指定类型的索引位置（以 < _Fy, _Indx > 结对进行操作）。
- * 
- * @param [in ] _Fy   : 待查找类型。
- * @param [in ] _Indx : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
- * @param [in ] _Ty   : tuple 的参数列表。
- * 
- * @return size_t
- *         - 返回索引位置;
- *         - 若返回值大于等于 X_type_index< _Fy, _Indx >::value[0x1FFFFFFF] 时，表示未找到查找的类型。
- */
-template< typename _Fy, size_t _Indx, typename... _Ty >
-constexpr size_t X_tuple_type_index(const std::tuple< _Ty... > &)
-{
-    return X_type_index< _Fy, _Indx, _Ty... >::value;
-}
-
-/**
- * @brief X_type_index 和 X_tuple_type_index() 接口的测试代码如下所示。
- * @code
- * <pre>
- * #include <type_traits>
- * #include <tuple>
- * #include <iostream>
- * 
- * int main(int argc, char * argv[])
- * {
- *     std::cout << "< int   , 0 > : " << nstuple::X_type_index< int , 0 >::value << std::endl;
- *     std::cout << "< int   , 0 > : " << nstuple::X_type_index< int , 0, int >::value << std::endl;
- *     std::cout << "< char  , 0 > : " << nstuple::X_type_index< char, 0, int, int >::value << std::endl;
- *     std::cout << "< int   , 1 > : " << nstuple::X_type_index< int , 1, int, int, char >::value << std::endl;
- *     std::cout << "< char  , 0 > : " << nstuple::X_type_index< char, 0, int, int, char, char >::value << std::endl;
- *     std::cout << "< char  , 1 > : " << nstuple::X_type_index< char, 1, int, int, char, char, char >::value << std::endl;
- * 
- *     std::cout << "< int   , 1 > : " << nstuple::X_tuple_type_index< int   , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- *     std::cout << "< int & , 1 > : " << nstuple::X_tuple_type_index< int & , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- *     std::cout << "< char  , 1 > : " << nstuple::X_tuple_type_index< char  , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- *     std::cout << "< double, 1 > : " << nstuple::X_tuple_type_index< double, 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- *     std::cout << "< float , 1 > : " << nstuple::X_tuple_type_index< float , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- *     std::cout << "< void *, 1 > : " << nstuple::X_tuple_type_index< void *, 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
- * 
- *     std::tuple< int, int, int, char, float, double > xtuple{ 100, 200, 300, 'A', 1.234F, 1.234 };
- * 
- *     std::cout << " xtpule< 0 > = " << std::get< 0 >(xtuple) << std::endl;
- *     std::cout << " xtpule< 1 > = " << std::get< 1 >(xtuple) << std::endl;
- *     std::cout << " xtpule< 2 > = " << std::get< 2 >(xtuple) << std::endl;
- *     std::cout << " xtpule< 3 > = " << std::get< 3 >(xtuple) << std::endl;
- *     std::cout << " xtpule< 4 > = " << std::get< 4 >(xtuple) << std::endl;
- *     std::cout << " xtpule< 5 > = " << std::get< 5 >(xtuple) << std::endl;
- * 
- *     std::get< nstuple::X_tuple_type_index< int   , 0 >(xtuple) >(xtuple) = 101;
- *     std::get< nstuple::X_tuple_type_index< int   , 1 >(xtuple) >(xtuple) = 201;
- *     std::get< nstuple::X_tuple_type_index< int   , 2 >(xtuple) >(xtuple) = 301;
- *     std::get< nstuple::X_tuple_type_index< char  , 0 >(xtuple) >(xtuple) = 'B';
- *     std::get< nstuple::X_tuple_type_index< float , 0 >(xtuple) >(xtuple) = 1.245F;
- *     std::get< nstuple::X_tuple_type_index< double, 0 >(xtuple) >(xtuple) = 1.236;
- * 
- *     std::cout << " xtpule< int   , 0 >[0] = " << std::get< 0 >(xtuple) << std::endl;
- *     std::cout << " xtpule< int   , 1 >[1] = " << std::get< 1 >(xtuple) << std::endl;
- *     std::cout << " xtpule< int   , 2 >[2] = " << std::get< 2 >(xtuple) << std::endl;
- *     std::cout << " xtpule< char  , 0 >[3] = " << std::get< 3 >(xtuple) << std::endl;
- *     std::cout << " xtpule< float , 0 >[4] = " << std::get< 4 >(xtuple) << std::endl;
- *     std::cout << " xtpule< double, 0 >[5] = " << std::get< 5 >(xtuple) << std::endl;
- * 
- *     return 0;
- * }
- * </pre>
- * @endcode
- */
-
-////////////////////////////////////////////////////////////////////////////////
-
-}; // namaspace nstuple
-
-////////////////////////////////////////////////////////////////////////////////
-// x_threadpool_t
-
-/**
- * @class x_threadpool_t
- * @brief 线程池类。
- */
-class x_threadpool_t
-{
-    // common data types
-private:
-    using x_locker_t = std::mutex;
-
-public:
-    /** 前置声明 */
-    struct x_running_checker_t;
-    struct x_task_deleter_t;
-
-    /**
-     * @struct x_task_t
-     * @brief  任务对象的抽象基类。
-     * @note   参看 @see get_deleter() 接口的说明。
-     */
-    struct x_task_t
-    {
-        // constructor/destructor
-    public:
-        virtual ~x_task_t(void) { }
-
-        // extensible interfaces
-    public:
-        /**********************************************************/
-        /**
-         * @brief 任务对象执行流程的抽象接口。
-         */
-        virtual void run(x_running_checker_t * xchecker_ptr) = 0;
-
-        /**********************************************************/
-        /**
-         * @brief 判断 任务对象 是否挂起。
-         * @note
-         * <pre>
-         *   在启动线程池时，若选择检测任务对象的挂起状态，该接口有效。
-         *   即，任务对象处于挂起状态，工作线程提取任务时，则跳过该对象。
-         * </pre>
-         */
-        virtual bool is_suspend(void) const { return false; }
-
-        /**********************************************************/
-        /**
-         * @brief 设置任务对象的运行标识。
-         * 
-         * @note
-         * <pre>
-         *   工作线程在提取到任务对象后，则立即调用 set_running_flag(true) 操作；
-         *   执行 run() 操作返回后，又调用 set_running_flag(false) 操作。
-         * </pre>
-         */
-        virtual void set_running_flag(bool xrunning_flag) { }
-
-        /**********************************************************/
-        /**
-         * @brief 获取任务对象的删除器，重载该接口，可实现自定义的任务对象回收方式。
-         * 
-         * @note
-         * <pre>
-         *   任务对象提交至线程池后，工作线程会调用任务对象的 run() 
-         *   接口执行具体的任务操作流程，run() 接口返回后，
-         *   线程池的工作线程会调用该接口，获取任务对象的删除器，
-         *   然后使用 删除器 对 任务对象 进行资源回收操作。
-         *   重载该接口，获取自定义的删除器对象，则可实现自定义的资源回收方式。
-         * </pre>
-         */
-        virtual const x_task_deleter_t * get_deleter(void) const
-        {
-            return &x_threadpool_t::_S_task_common_deleter;
-        }
-    };
-
-    /** 任务对象指针类型 */
-    using x_task_ptr_t = x_task_t *;
-
-    /**
-     * @struct x_running_checker_t
-     * @brief  辅助 x_task_t 对象进行回调判断线程池是否可继续运行，以便于对任务执行流程进行终止操作。
-     */
-    struct x_running_checker_t final
-    {
-        friend x_threadpool_t;
-
-        // constructor/destructor
-    private:
-        x_running_checker_t(const x_threadpool_t * xthis_pool_ptr, size_t xthread_index)
-            : m_this_pool_ptr(xthis_pool_ptr)
-            , m_xthread_index(xthread_index)
-        {
-        }
-
-        ~x_running_checker_t(void)
-        {
-        }
-
-        x_running_checker_t(x_running_checker_t && xobject) = delete;
-        x_running_checker_t & operator=(x_running_checker_t && xobject) = delete;
-        x_running_checker_t(const x_running_checker_t & xobject) = delete;
-        x_running_checker_t & operator=(const x_running_checker_t & xobject) = delete;
-
-        // common data types
-    public:
-        using x_holder_t = x_running_checker_t *;
-
-        /**********************************************************/
-        /**
-         * @brief 返回 x_running_checker_t 的占位对象。
-         * @note  参看 x_threadpool_t::submit_task_ex() 接口的使用说明。
-         */
-        static inline const x_holder_t xholder(void) { return nullptr; };
-
-        // public interfaces
-    public:
-        /**********************************************************/
-        /**
-         * @brief 回调判断当前工作线程是否可继续运行。
-         */
-        inline bool is_enable_running(void) const
-        {
-            return (m_this_pool_ptr->is_enable_running() &&
-                    m_this_pool_ptr->is_within_capacity(m_xthread_index));
-        }
-
-        /**********************************************************/
-        /**
-         * @brief 返回所属的线程索引号。
-         */
-        inline size_t thread_index(void) const
-        {
-            return m_xthread_index;
-        }
-
-        // data members
-    private:
-        const x_threadpool_t * m_this_pool_ptr;  ///< 所属的线程池对象
-        const size_t           m_xthread_index;  ///< 所属的线程索引号
-    };
-
-    /**
-     * @struct x_task_deleter_t
-     * @brief  任务对象的删除器接口类。
-     */
-    struct x_task_deleter_t
-    {
-        // extensible interfaces
-    public:
-        /**********************************************************/
-        /**
-         * @brief 对 任务对象 进行资源回收操作（删除操作）。
-         */
-        virtual void delete_task(x_task_ptr_t xtask_ptr)
-        {
-            if (nullptr != xtask_ptr)
-                delete xtask_ptr;
-        }
-    };
-
-private:
-    /** 任务对象的通用删除器 */
-    static x_task_deleter_t _S_task_common_deleter;
-
-private:
-    /**
-     * @struct x_task_bind_t
-     * @brief  内部的任务对象实现类。
-     */
-    template< typename _Func >
-    struct x_task_bind_t : public x_task_t
-    {
-        // constructor/destructor
-    public:
-        x_task_bind_t(_Func && xfunc) : _M_func(std::forward< _Func >(xfunc))
-        {
-
-        }
-
-        // overrides
-    public:
-        /**********************************************************/
-        /**
-         * @brief 任务对象执行流程。
-         */
-        virtual void run(x_running_checker_t * xchecker_ptr) override
-        {
-            _M_func();
-        }
-
-        // data members
-    protected:
-        _Func _M_func;   ///< 任务对象执行流程的工作接口（函数对象）
-    };
-
-    /**
-     * @struct x_task_tuple_t
-     * @brief  内部的任务对象实现类（带 x_running_checker_t 回调检测对象）。
-     */
-    template< typename _Func, typename _Tuple, size_t _Xholder_Index >
-    struct x_task_tuple_t : public x_task_t
-    {
-        using _Indices = typename nstuple::X_Build_index_tuple< std::tuple_size< _Tuple >::value >::__type;
-
-        // constructor/destructor
-    public:
-        x_task_tuple_t(_Func && xfunc, _Tuple && xargs)
-            : _M_func(std::forward< _Func >(xfunc))
-            , _M_args(std::forward< _Tuple >(xargs))
-        {
-
-        }
-
-        // overrides
-    public:
-        /**********************************************************/
-        /**
-         * @brief 任务对象执行流程。
-         */
-        virtual void run(x_running_checker_t * xchecker_ptr) override
-        {
-            try { invoke(xchecker_ptr, _Indices()); } catch (...) { }
-        }
-
-        // internal invoking
-    private:
-        /**********************************************************/
-        /**
-         * @brief 执行流程。
-         */
-        template< size_t... _Ind >
-        void invoke(x_running_checker_t * xchecker_ptr, nstuple::X_Index_tuple< _Ind... >)
-        {
-            std::get< _Xholder_Index >(_M_args) = xchecker_ptr;
-            auto xinvoker = std::bind(std::forward< _Func >(_M_func),
-                                      std::get< _Ind >(std::move(_M_args))...);
-            xinvoker();
-        }
-
-        // data members
-    private:
-        _Func  _M_func;   ///< 任务对象执行流程的工作接口
-        _Tuple _M_args;   ///< 回调的工作参数
-    };
-
-    // common invoking
-private:
-    /** 特化 x_task_maker_t<> 对象后可进行 make_task() 接口的选择。 */
-    template< size_t > struct x_task_maker_t
-    {
-
-    };
-
-    /**********************************************************/
-    /**
-     * @brief 以 bind 参数方式创建任务对象。
-     */
-    template< typename _Func, typename... _Args >
-    static x_task_ptr_t make_task(const x_task_maker_t< 0 > & xmaker, _Func && xfunc, _Args && ... xargs)
-    {
-        auto xbinder = std::bind(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
-        return (new x_task_bind_t< decltype(xbinder) >(std::forward< decltype(xbinder) >(xbinder)));
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 以 tuple 参数方式创建任务对象。
-     */
-    template< typename _Func, typename... _Args >
-    static x_task_ptr_t make_task(const x_task_maker_t< 1 > & xmaker, _Func && xfunc, _Args && ... xargs)
-    {
-        using _Tuple = typename std::tuple< typename std::decay< _Args >::type... >;
-        using _Index = typename nstuple::X_type_index< x_running_checker_t::x_holder_t, 0, _Args... >;
-
-        _Tuple xtuple{ std::forward< _Args >(xargs)... };
-
-        constexpr size_t const xholder_index = _Index::value;
-
-        return (new x_task_tuple_t< _Func, _Tuple, xholder_index >(
-                    std::forward< _Func >(xfunc), std::forward< _Tuple >(xtuple)));
-    }
-
-    // common invoking
-public:
-    /**********************************************************/
-    /**
-     * @brief 返回硬件线程上下文的数量。
-     */
-    static inline size_t hardware_concurrency(void) noexcept
-    {
-        return std::thread::hardware_concurrency();
-    }
-
-    // constructor/destructor
-public:
-    explicit x_threadpool_t(void) noexcept
-        : m_enable_running(false)
-        , m_xthds_capacity(0)
-        , m_check_suspened(false)
-        , m_xst_get_task(0)
-        , m_xst_lst_tasks(0)
-        , m_xst_task_count(0)
-    {
-
-    }
-
-    ~x_threadpool_t(void)
-    {
-        if (is_startup())
-            shutdown();
-        cleanup_task();
-    }
-
-    x_threadpool_t(x_threadpool_t && xobject) = delete;
-    x_threadpool_t & operator=(x_threadpool_t && xobject) = delete;
-    x_threadpool_t(const x_threadpool_t & xobject) = delete;
-    x_threadpool_t & operator=(const x_threadpool_t & xobject) = delete;
-
-    // public interfaces
-public:
-    /**********************************************************/
-    /**
-     * @brief 启动线程池。
-     * 
-     * @param [in ] xthds          : 工作线程的数量（若为 0，将取 hardware_concurrency() 返回值的 2倍 + 1）。
-     * @param [in ] check_suspened : 是否检测任务对象的挂起状态。
-     * 
-     * @return bool
-     *         - 成功，返回 true；
-     *         - 失败，返回 false。
-     */
-    bool startup(size_t xthds = 0, bool check_suspened = false)
-    {
-        // 检测当前是否已经启动
-        if (is_startup())
-            return false;
-
-        // 启动各个工作线程
-        try
-        {
-            m_check_suspened = check_suspened;
-
-            m_xst_get_task.store(0);
-            resize((0 != xthds) ? xthds : (2 * hardware_concurrency() + 1));
-        }
-        catch(...)
-        {
-            shutdown();
-            return false;
-        }
-
-        return true;
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 关闭线程池。
-     */
-    void shutdown(void)
-    {
-        try
-        {
-            resize(0);
-        }
-        catch(...)
-        {
-
-        }
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 判断是否已经启动。
-     */
-    inline bool is_startup(void) const
-    {
-        return (m_enable_running && !m_lst_threads.empty());
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 返回 线程池对象是否可继续运行 的标识。
-     */
-    inline bool is_enable_running(void) const { return m_enable_running; }
-
-    /**********************************************************/
-    /**
-     * @brief 返回工作线程数量。
-     */
-    inline size_t size(void) const
-    {
-        std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
-        return m_lst_threads.size();
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 调整工作线程数量。
-     */
-    void resize(size_t xthds)
-    {
-        std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
-
-        size_t xst_size = m_lst_threads.size();
-
-        m_enable_running = (0 != xthds);
-        m_xthds_capacity = xthds;
-
-        if (xthds > xst_size)
-        {
-            // 增加工作线程数量
-            for (size_t xiter_index = xst_size; xiter_index < xthds; ++xiter_index)
-            {
-                m_lst_threads.push_back(
-                    std::thread([this](size_t xiter_index) -> void
-                                {
-                                    thread_run(xiter_index);
-                                },
-                                xiter_index));
-            }
-        }
-        else if (xst_size > 0)
-        {
-            // 通知所有工作线程对象，检测退出事件
-            {
-                std::lock_guard< x_locker_t > xautolock_task(m_lock_smt_task);
-                m_thds_notifier.notify_all();
-            }
-
-            // 递减工作线程数量
-            while (xst_size > xthds)
-            {
-                std::thread & t = m_lst_threads.back();
-                if (t.joinable())
-                    t.join();
-                m_lst_threads.pop_back();
-                xst_size -= 1;
-            }
-        }
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 提交任务对象。
-     */
-    void submit_task(x_task_ptr_t xtask_ptr)
-    {
-        if (nullptr != xtask_ptr)
-        {
-            m_lock_smt_task.lock();
-
-            m_lst_smt_tasks.push_back(xtask_ptr);
-            m_xst_lst_tasks.fetch_add(1);
-            m_xst_task_count.fetch_add(1);
-
-            m_lock_smt_task.unlock();
-
-            m_thds_notifier.notify_one();
-        }
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 提交任务对象（支持 仿函数对象 与 lambda 表达式 等类函数的泛型接口）。
-     * 
-     * @note xfunc 的回调操作过程中，若需要进行运行时检测（判断工作线程是否可继续运行），
-     * 可在 xargs 参数列表中添加一个（且最多一个） x_running_checker_t::x_holder_t 
-     * 占位对象。
-     */
-    template< typename _Func, typename... _Args >
-    void submit_task_ex(_Func && xfunc, _Args && ... xargs)
-    {
-        constexpr size_t const xchecker_count =
-                nstuple::X_type_count<
-                    x_running_checker_t::x_holder_t,
-                    typename std::decay< _Args >::type... >::value;
-
-        static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
-
-        submit_task(make_task(
-                        x_task_maker_t< xchecker_count >(),
-                        std::forward< _Func >(xfunc),
-                        std::forward< _Args >(xargs)...));
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 返回任务对象数量。
-     */
-    inline size_t task_count(void) const { return m_xst_task_count; }
-
-    /**********************************************************/
-    /**
-     * @brief 清除任务队列中所有的任务对象。
-     */
-    void cleanup_task(void)
-    {
-        x_task_ptr_t       xtask_ptr    = nullptr;
-        x_task_deleter_t * xdeleter_ptr = nullptr;
-
-        m_xst_get_task.fetch_add(1);
-
-        std::lock_guard< x_locker_t > xautolock_run(m_lock_run_task);
-        std::lock_guard< x_locker_t > xautolock_smt(m_lock_smt_task);
-
-        if (!m_lst_smt_tasks.empty())
-        {
-            m_lst_run_tasks.splice(m_lst_run_tasks.end(), std::move(m_lst_smt_tasks));
-        }
-
-        while (!m_lst_run_tasks.empty())
-        {
-            xtask_ptr = m_lst_run_tasks.front();
-            m_lst_run_tasks.pop_front();
-
-            if (nullptr != xtask_ptr)
-            {
-                xdeleter_ptr = const_cast< x_task_deleter_t * >(xtask_ptr->get_deleter());
-                if (nullptr != xdeleter_ptr)
-                {
-                    xdeleter_ptr->delete_task(xtask_ptr);
-                    xdeleter_ptr = nullptr;
-                }
-
-                xtask_ptr = nullptr;
-            }
-        }
-
-        m_xst_get_task.store(0);
-        m_xst_lst_tasks.store(0);
-        m_xst_task_count.store(0);
-    }
-
-    // internal invoking
-private:
-    /**********************************************************/
-    /**
-     * @brief 获取任务队列的任务数量。
-     */
-    inline size_t get_lst_task_size(void) const
-    {
-        return m_xst_lst_tasks;
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 当前是否可提取待执行的任务对象。
-     */
-    inline bool is_enable_get_task(void) const
-    {
-        return (0 == m_xst_get_task.load());
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 从任务队列中提取任务对象。
-     */
-    x_task_ptr_t get_task(void)
-    {
-        x_task_ptr_t xtask_ptr = nullptr;
-        if (!is_enable_get_task())
-        {
-            return nullptr;
-        }
-
-        std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
-
-        {
-            m_lock_smt_task.lock();
-            if (!m_lst_smt_tasks.empty())
-            {
-                m_lst_run_tasks.splice(m_lst_run_tasks.end(), std::move(m_lst_smt_tasks));
-            }
-            m_lock_smt_task.unlock();
-        }
-
-        if (m_check_suspened)
-        {
-            for (std::list< x_task_ptr_t >::iterator itlst = m_lst_run_tasks.begin();
-                 (itlst != m_lst_run_tasks.end()) && is_enable_get_task();
-                 ++itlst)
-            {
-                if ((nullptr == *itlst) || !(*itlst)->is_suspend())
-                {
-                    xtask_ptr = *itlst;
-                    m_lst_run_tasks.erase(itlst);
-                    m_xst_lst_tasks.fetch_sub(1);
-                    break;
-                }
-            }
-        }
-        else
-        {
-            while (!m_lst_run_tasks.empty())
-            {
-                xtask_ptr = m_lst_run_tasks.front();
-                m_lst_run_tasks.pop_front();
-
-                if (nullptr != xtask_ptr)
-                {
-                    break;
-                }
-            }
-        }
-
-        if (nullptr != xtask_ptr)
-        {
-            xtask_ptr->set_running_flag(true);
-        }
-
-        return xtask_ptr;
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 判断线程索引号是否超过 工作线程对象的上限数量。
-     */
-    inline bool is_overtop_capacity(size_t xthread_index) const
-    {
-        return (xthread_index >= m_xthds_capacity);
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 判断线程索引号是否在工作线程对象的上限数量 之内。
-     */
-    inline bool is_within_capacity(size_t xthread_index) const
-    {
-        return (xthread_index < m_xthds_capacity);
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 使当前线程让出 CPU 时间片。
-     */
-    inline void thread_yield(size_t & xcounter)
-    {
-        if (xcounter++ < 16)
-        {
-            std::this_thread::yield();
-        }
-        else
-        {
-            xcounter = 0;
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
-    }
-
-    /**********************************************************/
-    /**
-     * @brief 工作线程的执行流程。
-     */
-    void thread_run(size_t xthread_index)
-    {
-        x_running_checker_t xht_checker(this, xthread_index);
-
-        x_task_ptr_t       xtask_ptr    = nullptr;
-        x_task_deleter_t * xdeleter_ptr = nullptr;
-
-        size_t xcounter = 0;
-
-        while (xht_checker.is_enable_running())
-        {
-            if (get_lst_task_size() <= 0)
-            {
-                std::unique_lock< x_locker_t > xunique_locker(m_lock_smt_task);
-                m_thds_notifier.wait(xunique_locker,
-                                     [this, &xht_checker](void) -> bool
-                                     {
-                                         return ((get_lst_task_size() > 0) ||
-                                                 (!xht_checker.is_enable_running()));
-                                     });
-            }
-
-            if (!xht_checker.is_enable_running())
-            {
-                break;
-            }
-
-            xtask_ptr = get_task();
-            if (nullptr == xtask_ptr)
-            {
-                if (get_lst_task_size() > 0)
-                    thread_yield(xcounter);
-                continue;
-            }
-
-            if (xht_checker.is_enable_running())
-            {
-                xtask_ptr->run(&xht_checker);
-            }
-
-            if (m_check_suspened)
-            {
-                // 执行完任务对象后，将任务对象转换为 非挂起状态，
-                // 加锁进行操作，是为了与 get_task() 内的操作保持队列的同步
-
-                // 标识当前不可提取待执行的任务对象，迫使 get_task() 内部迅速解锁
-                m_xst_get_task.fetch_add(1);
-
-                m_lock_run_task.lock();
-                xtask_ptr->set_running_flag(false);
-                m_lock_run_task.unlock();
-
-                m_xst_get_task.fetch_sub(1);
-            }
-            else
-            {
-                xtask_ptr->set_running_flag(false);
-            }
-
-            xdeleter_ptr = const_cast< x_task_deleter_t * >(xtask_ptr->get_deleter());
-            if (nullptr != xdeleter_ptr)
-            {
-                xdeleter_ptr->delete_task(xtask_ptr);
-            }
-
-            m_xst_task_count.fetch_sub(1);
-        }
-    }
-
-    // data members
-private:
-    volatile bool              m_enable_running;  ///< 工作线程继续运行的标识值
-    mutable x_locker_t         m_lock_thread;     ///< 工作线程对象的队列的同步操作锁
-    volatile size_t            m_xthds_capacity;  ///< 工作线程对象的上限数量
-    std::list< std::thread >   m_lst_threads;     ///< 工作线程对象的队列
-
-    std::condition_variable    m_thds_notifier;   ///< 工作线程对象的通知器（条件变量）
-
-    mutable x_locker_t         m_lock_smt_task;   ///< 用于提交操作的任务队列的同步操作锁
-    std::list< x_task_ptr_t >  m_lst_smt_tasks;   ///< 用于提交操作的任务队列
-
-    bool                       m_check_suspened;  ///< 提取任务对象时，是否检测其挂起状态
-    mutable x_locker_t         m_lock_run_task;   ///< 待执行的任务队列的同步操作锁
-    std::list< x_task_ptr_t >  m_lst_run_tasks;   ///< 待执行的任务队列
-
-    std::atomic< size_t >      m_xst_get_task;    ///< 仅为 0 时，表示当前可提取待执行的任务对象
-    std::atomic< size_t >      m_xst_lst_tasks;   ///< 任务队列中的对象数量
-    std::atomic< size_t >      m_xst_task_count;  ///< 任务对象总数量的计数器
-};
-
-//====================================================================
-
-#ifndef SELECTANY
-#ifdef _MSC_VER
-#define SELECTANY   __declspec(selectany)
-#else // !_MSC_VER
-#define SELECTANY   __attribute__((weak))
-#endif // _MSC_VER
-#endif // SELECTANY
-
-/* 任务对象的通用删除器 */
-SELECTANY x_threadpool_t::x_task_deleter_t x_threadpool_t::_S_task_common_deleter;
-
-//====================================================================
-
-typedef x_threadpool_t::x_running_checker_t x_running_checker_t;
-typedef x_threadpool_t::x_task_t            x_task_t;
-typedef x_threadpool_t::x_task_deleter_t    x_task_deleter_t;
-typedef x_threadpool_t::x_task_ptr_t        x_task_ptr_t;
-
-////////////////////////////////////////////////////////////////////////////////
-
-#endif // __XTHREADPOOL_H__
+﻿/**
+ * The MIT License (MIT)
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file    xthreadpool.h
+ * <pre>
+ * Copyright (c) 2019, Gaaagaa All rights reserved.
+ * 
+ * 文件名称：xthreadpool.h
+ * 创建日期：2018年12月12日
+ * 文件标识：
+ * 文件摘要：使用 C++11 新标准 thread 线程对象实现的线程池类。
+ * 
+ * 当前版本：1.27.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加任务对象生命周期的追踪（XTHREADPOOL_ENABLE_TRACE），按工作线程的无锁环形缓存记录，导出为 Chrome Trace Event JSON。
+ * 
+ * 历史版本：1.26.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加运行统计：工作线程级别的计数、排队与执行时长的直方图，snapshot() 与 Prometheus 文本格式输出。
+ * 
+ * 历史版本：1.25.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加 NUMA 感知模式：按节点分组工作线程、就近投递、节点内优先窃取，工作线程私有数据在所属节点上分配。
+ * 
+ * 历史版本：1.24.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加工作线程的 CPU 亲和性策略（紧凑、分散、指定列表、进程 cpuset），x_running_checker_t::pinned_cpu() 返回绑定的 CPU。
+ * 
+ * 历史版本：1.23.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加弹性模式：min_threads/max_threads、空闲超时退出、按队列深度与排队时长增加工作线程的控制线程。
+ * 
+ * 历史版本：1.22.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：resize() 减少工作线程数量时不再阻塞（先空闲的先退出）；增加 resize_async()；size() 不加锁。
+ * 
+ * 历史版本：1.21.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：空闲工作线程改为以 LIFO 空闲栈与各自的 futex 槽位进行定向唤醒。
+ * 
+ * 历史版本：1.20.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：增加工作线程的退避策略 x_config_t::idle_policy（自适应的 自旋 → 让出时间片 → 挂起等待），取代固定的 yield + sleep(1ms)。
+ * 
+ * 历史版本：1.19.0.0
+ * 作    者：
+ * 完成日期：2026年10月17日
+ * 版本摘要：泛型接口改为在 tuple 上直接展开参数进行调用（INVOKE 语义，取代 std::bind()），支持仅可移动的函数对象与参数，减少参数拷贝。
+ * 
+ * 历史版本：1.18.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：内部任务对象改由分级分配器 x_task_alloc_t 分配（线程本地缓存、整批归还），并提供 alloc_stats() 统计接口。
+ * 
+ * 历史版本：1.17.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：泛型接口创建的任务对象改为内联存储函数对象的 x_task_slot_t（固定大小、回收复用），超出内联空间时仍使用堆分配。
+ * 
+ * 历史版本：1.16.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加 C++20 协程支持：schedule()、x_co_task_t（对称转移、线程池所属的协程帧分配器）与 submit_coroutine()。
+ * 
+ * 历史版本：1.15.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加任务续接 then()、when_all/when_any 组合与静态任务依赖图 x_task_graph_t。
+ * 
+ * 历史版本：1.14.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加 current_checker() 接口，供并行算法按工作线程索引私有数据。
+ * 
+ * 历史版本：1.13.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加 idle_count() 接口，供 xparallel.h 中的并行算法判断是否拆分任务区间。
+ * 
+ * 历史版本：1.12.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加 wait_idle() 与任务组 x_task_group_t，以 futex 唤醒代替轮询 task_count()。
+ * 
+ * 历史版本：1.11.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加返回执行结果的提交接口 submit_with_result() 与轻量级的 x_future_t。
+ * 
+ * 历史版本：1.10.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加任务对象的容量上限与背压策略（阻塞、调用方执行、丢弃最早的任务对象，以及 try_submit）。
+ * 
+ * 历史版本：1.9.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加基于分层时间轮的延迟/周期任务对象（submit_after、submit_at、submit_every）。
+ * 
+ * 历史版本：1.8.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加任务对象的优先级车道（含老化处理）。
+ * 
+ * 历史版本：1.7.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加按键值串行执行任务对象的接口（submit_ordered）。
+ * 
+ * 历史版本：1.6.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加批量提交任务对象的接口 submit_tasks() 与 submit_tasks_ex()，
+ *          整批任务对象一次入队、计数值只更新一次，并按需唤醒工作线程。
+ * 
+ * 历史版本：1.5.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：x_task_t 增加侵入式的链接指针，提交队列改为侵入式的 MPSC 无锁队列，
+ *          待执行队列改为侵入式单向链表，提交/转移/提取任务对象的过程不再分配链表节点。
+ * 
+ * 历史版本：1.4.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加可选的无锁环形提交队列（参看 x_config_t::ring_capacity），
+ *          提交与提取任务对象时不加锁、不分配内存（队列已满时，转入原有的任务队列）。
+ * 
+ * 历史版本：1.3.0.0
+ * 作    者：
+ * 完成日期：2026年10月16日
+ * 版本摘要：增加工作窃取的调度模式（参看 x_config_t::work_stealing），
+ *          各个工作线程拥有本地的 Chase-Lev 双端队列，空闲时随机窃取其他工作线程的任务对象。
+ * 
+ * 历史版本：1.2.0.1
+ * 作    者：
+ * 完成日期：2019年10月13日
+ * 版本摘要：改用原子操作的整数计数变量，判断当前是否可提取待执行的任务对象。
+ * 
+ * 历史版本：1.2.0.0
+ * 作    者：
+ * 完成日期：2019年01月18日
+ * 版本摘要：任务对象增加挂起判断接口，解决“某一类任务对象在线程池中可顺序执行”的问题。
+ * 
+ * 历史版本：1.1.0.0
+ * 作    者：
+ * 完成日期：2018年12月16日
+ * 版本摘要：增加模板参数列表的类型索引功能（请参看 X_type_index 的设计），
+ *          使得 x_threadpool_t::submit_task_ex() 接口的 xargs 参数列表
+ *          中的 x_running_checker_t::x_holder_t 类型参数可放置在任意位置。
+ * 
+ * 历史版本：1.0.0.0
+ * 原作者  ：
+ * 完成日期：2018年12月12日
+ * 版本摘要：
+ * </pre>
+ */
+
+#ifndef __XTHREADPOOL_H__
+#define __XTHREADPOOL_H__
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <utility>
+#include <tuple>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <exception>
+
+#ifndef XTHREADPOOL_HAS_COROUTINE
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#define XTHREADPOOL_HAS_COROUTINE 1
+#endif
+#endif // defined(__has_include)
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+#ifndef XTHREADPOOL_HAS_COROUTINE
+#define XTHREADPOOL_HAS_COROUTINE 0
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+#if XTHREADPOOL_HAS_COROUTINE
+#include <coroutine>
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+// 任务对象生命周期的追踪（参看 x_threadpool_t::start_trace()）；为 0 时，相关的代码均不参与编译
+#ifndef XTHREADPOOL_ENABLE_TRACE
+#define XTHREADPOOL_ENABLE_TRACE 0
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif // defined(_MSC_VER)
+
+#if defined(__linux__)
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <pthread.h>
+#endif // defined(__linux__)
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 命名空间内定义一些 std::tuple 相关操作的辅助接口。
+ */
+namespace nstuple
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Stores a tuple of indices. Used by bind() to extract the elements in a tuple. 
+ */
+template< size_t... _Indexes >
+struct X_Index_tuple
+{
+
+};
+
+/// Builds an X_Index_tuple< 0, 1, 2, ..., _Num - 1 >.
+template< size_t _Num, typename _Tuple = X_Index_tuple<> >
+struct X_Build_index_tuple;
+
+template< size_t _Num, size_t... _Indexes >
+struct X_Build_index_tuple< _Num, X_Index_tuple< _Indexes... > >
+    : X_Build_index_tuple< _Num - 1, X_Index_tuple< _Indexes..., sizeof...(_Indexes) > >
+{
+
+};
+
+template< size_t... _Indexes >
+struct X_Build_index_tuple< 0, X_Index_tuple< _Indexes... > >
+{
+    typedef X_Index_tuple< _Indexes... > __type;
+};
+
+/**
+ * @brief 
+ * <pre>
+ *   本区段的代码改写自 gcc 8.2.0 版内的 STL 源码（functional 文件）。
+ *   主要用于 std::tuple 对象的参数解包操作，可参看如下示例代码。
+ * </pre>
+ * 
+ * @code
+ * <pre>
+ * #include <tuple>
+ * #include <iostream>
+ * 
+ * void call_test(int v1, float v2, double v3)
+ * {
+ *     std::cout << "(v1, v2, v3) : "
+ *               << "("  << v1
+ *               << ", " << v2
+ *               << ", " << v3
+ *               << ")"  << std::endl;
+ * }
+ * 
+ * using X_Tuple   = std::tuple< int, float, double >;
+ * using X_Indices = nstuple::X_Build_index_tuple< std::tuple_size< X_Tuple >::value >::__type;
+ * 
+ * template< size_t... _Ind >
+ * void _S_Invoke(X_Tuple && xtuple, nstuple::X_Index_tuple< _Ind... >)
+ * {
+ *     call_test(std::get< _Ind >(std::move(xtuple))...);
+ * }
+ * 
+ * int main(int argc, char * argv[])
+ * {
+ *     X_Tuple xtuple{ 1234, 1.234F, 1.234 };
+ *     _S_Invoke(std::forward< X_Tuple >(xtuple), X_Indices());
+ * 
+ *     return 0;
+ * }
+ * </pre>
+ * @endcode
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct X_check
+ * @brief  协助 X_tuple_has_type() 进行类型检查。
+ */
+template< bool... >
+struct X_type_check
+{
+
+};
+
+/**
+ * @brief 判断 tuple 对象内是否包含某个数据类型。
+ * 
+ * @param[in ] _Fy    : 待判断的数据类型。
+ * @param[in ] _Ty... : tuple 的参数列表。
+ * 
+ */
+template< typename _Fy, typename... _Ty >
+constexpr bool X_tuple_has_type(const std::tuple< _Ty... > &)
+{
+    return !std::is_same< X_type_check< false, std::is_same< _Fy, _Ty >::value... >,
+                          X_type_check< std::is_same< _Fy, _Ty >::value..., false > >::value;
+}
+
+/**
+ * @brief X_tuple_has_type() 接口的测试代码如下所示。
+ * @code
+ * <pre>
+ * #include <type_traits>
+ * #include <tuple>
+ * #include <iostream>
+ * 
+ * int main(int argc, char * argv[])
+ * {
+ *     std::cout << std::boolalpha;
+ *     std::cout << nstuple::X_tuple_has_type< int    >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
+ *     std::cout << nstuple::X_tuple_has_type< char   >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
+ *     std::cout << nstuple::X_tuple_has_type< double >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
+ *     std::cout << nstuple::X_tuple_has_type< float  >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
+ *     std::cout << nstuple::X_tuple_has_type< void   >(std::tuple< int, char, double >{ 100, 'a', 3.1415926 }) << std::endl;
+ * 
+ *     return 0;
+ * }
+ * </pre>
+ * @endcode
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+
+/** X_type_count 的前置声明 */
+template< typename _Fy, typename... _Ty >
+struct X_type_count;
+
+/**
+ * @struct X_type_count< _Fy, _Hy, _Ty... >
+ * @brief  递归的数据类型统计类。
+ */
+template< typename _Fy, typename _Hy, typename... _Ty >
+struct X_type_count< _Fy, _Hy, _Ty... >
+{
+    enum { value = (int)(std::is_same< _Fy, _Hy >::value) + X_type_count< _Fy, _Ty... >::value };
+};
+
+/**
+ * @struct X_type_count< _Fy >
+ * @brief  终止递归的数据类型统计类。
+ */
+template< typename _Fy >
+struct X_type_count< _Fy >
+{
+    enum { value = 0 };
+};
+
+/**
+ * @brief 统计 tuple 对象内某个数据类型的数量。
+ */
+template< typename _Fy, typename... _Ty >
+constexpr size_t X_tuple_type_count(const std::tuple< _Ty... > &)
+{
+    return X_type_count< _Fy, _Ty... >::value;
+}
+
+/**
+ * @brief X_tuple_type_count() 接口的测试代码如下所示。
+ * @code
+ * <pre>
+ * #include <type_traits>
+ * #include <tuple>
+ * #include <iostream>
+ * 
+ * int main(int argc, char * argv[])
+ * {
+ *     std::cout << nstuple::X_type_count< int, int, int, char, char, double >::value << std::endl;
+ * 
+ *     std::cout << nstuple::X_tuple_type_count< int    >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
+ *     std::cout << nstuple::X_tuple_type_count< char   >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
+ *     std::cout << nstuple::X_tuple_type_count< double >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
+ *     std::cout << nstuple::X_tuple_type_count< float  >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
+ *     std::cout << nstuple::X_tuple_type_count< void * >(std::tuple< int, int, int, char, char, double >{}) << std::endl;
+ * 
+ *     return 0;
+ * }
+ * </pre>
+ * @endcode
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct X_type_index
+ * @brief  类型索引模板：从变参列表中查找指定类型的索引位置（以 < _Fy, _Indx > 结对进行判断）。
+ * 
+ * @param[in ] _Fy    : 待查找类型。
+ * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
+ * @param[in ] _Ty... : 变参列表。
+ */
+template< typename _Fy, size_t _Indx, typename... _Ty >
+struct X_type_index;
+
+/**
+ * @struct X_type_index_iter
+ * @brief  协助 X_type_index 进行 变参列表 递归遍历操作。
+ * 
+ * @param[in ] _Vy    : 模板特化的参数；
+ *                      为 true  时，转向 X_type_index_jter 继续进行递归遍历；
+ *                      为 false 时，转回 X_type_index 继续进行递归遍历。
+ * @param[in ] _Fy    : 待查找类型。
+ * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
+ * @param[in ] _Ty... : 变参列表。
+ */
+template< bool _Vy, typename _Fy, size_t _Indx, typename... _Ty >
+struct X_type_index_iter;
+
+/**
+ * @struct X_type_index_jter
+ * @brief  协助 X_type_index_iter 进行 变参列表 递归遍历操作。
+ * 
+ * @param[in ] _Indx  : 待查找类型在变参列表中的第几个（以 0 为起始索引）；
+ *                      为 0 时，终止递归下降，否则转回 X_type_index 继续进行递归遍历。
+ * @param[in ] _Fy    : 待查找类型。
+ * @param[in ] _Ty... : 变参列表。
+ */
+template< size_t _Indx, typename _Fy, typename... _Ty >
+struct X_type_index_jter;
+
+/**
+ * @brief 终止 X_type_index_jter 递归下降。
+ */
+template< typename _Fy, typename... _Ty >
+struct X_type_index_jter< 0, _Fy, _Ty... >
+{
+    enum { value = 0 };
+};
+
+/**
+ * @brief 转回 X_type_index 继续进行递归下降遍历。
+ */
+template< size_t _Indx, typename _Fy, typename... _Ty >
+struct X_type_index_jter
+{
+    enum { value = 1 + X_type_index< _Fy, _Indx - 1, _Ty... >::value };
+};
+
+/**
+ * @brief 转向 X_type_index_jter 继续进行递归遍历。
+ */
+template< typename _Fy, size_t _Indx, typename... _Ty >
+struct X_type_index_iter< true, _Fy, _Indx, _Ty... >
+{
+    enum { value = 0 + X_type_index_jter< _Indx, _Fy, _Ty...>::value };
+};
+
+/**
+ * @brief 转回 X_type_index 继续进行递归遍历。
+ */
+template< typename _Fy, size_t _Indx, typename... _Ty >
+struct X_type_index_iter< false, _Fy, _Indx, _Ty... >
+{
+    enum { value = 1 + X_type_index< _Fy, _Indx, _Ty... >::value };
+};
+
+/**
+ * @brief X_type_index 递归遍历入口。
+ */
+template< typename _Fy, size_t _Indx, typename _Hy, typename... _Ty >
+struct X_type_index< _Fy, _Indx, _Hy, _Ty... >
+{
+    enum { value = X_type_index_iter< std::is_same< _Fy, _Hy >::value, _Fy, _Indx, _Ty... >::value };
+};
+
+/**
+ * @brief X_type_index 递归遍历终结位置。
+ */
+template< typename _Fy, size_t _Indx >
+struct X_type_index< _Fy, _Indx >
+{
+    enum { value = 0x1FFFFFFF };
+};
+
+/**
+ * @brief 从 tuple 的变参列表中查找指定类型的索引位置（以 < _Fy, _Indx > 结对进行操作）。
+ * 
+ * @param [in ] _Fy   : 待查找类型。
+ * @param [in ] _Indx : 待查找类型在变参列表中的第几个（以 0 为起始索引）。
+ * @param [in ] _Ty   : tuple 的参数列表。
+ * 
+ * @return size_t
+ *         - 返回索引位置;
+ *         - 若返回值大于等于 X_type_index< _Fy, _Indx >::value[0x1FFFFFFF] 时，表示未找到查找的类型。
+ */
+template< typename _Fy, size_t _Indx, typename... _Ty >
+constexpr size_t X_tuple_type_index(const std::tuple< _Ty... > &)
+{
+    return X_type_index< _Fy, _Indx, _Ty... >::value;
+}
+
+/**
+ * @brief X_type_index 和 X_tuple_type_index() 接口的测试代码如下所示。
+ * @code
+ * <pre>
+ * #include <type_traits>
+ * #include <tuple>
+ * #include <iostream>
+ * 
+ * int main(int argc, char * argv[])
+ * {
+ *     std::cout << "< int   , 0 > : " << nstuple::X_type_index< int , 0 >::value << std::endl;
+ *     std::cout << "< int   , 0 > : " << nstuple::X_type_index< int , 0, int >::value << std::endl;
+ *     std::cout << "< char  , 0 > : " << nstuple::X_type_index< char, 0, int, int >::value << std::endl;
+ *     std::cout << "< int   , 1 > : " << nstuple::X_type_index< int , 1, int, int, char >::value << std::endl;
+ *     std::cout << "< char  , 0 > : " << nstuple::X_type_index< char, 0, int, int, char, char >::value << std::endl;
+ *     std::cout << "< char  , 1 > : " << nstuple::X_type_index< char, 1, int, int, char, char, char >::value << std::endl;
+ * 
+ *     std::cout << "< int   , 1 > : " << nstuple::X_tuple_type_index< int   , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ *     std::cout << "< int & , 1 > : " << nstuple::X_tuple_type_index< int & , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ *     std::cout << "< char  , 1 > : " << nstuple::X_tuple_type_index< char  , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ *     std::cout << "< double, 1 > : " << nstuple::X_tuple_type_index< double, 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ *     std::cout << "< float , 1 > : " << nstuple::X_tuple_type_index< float , 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ *     std::cout << "< void *, 1 > : " << nstuple::X_tuple_type_index< void *, 1 >(std::tuple< int, int, int, char, float, double >{}) << std::endl;
+ * 
+ *     std::tuple< int, int, int, char, float, double > xtuple{ 100, 200, 300, 'A', 1.234F, 1.234 };
+ * 
+ *     std::cout << " xtpule< 0 > = " << std::get< 0 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< 1 > = " << std::get< 1 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< 2 > = " << std::get< 2 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< 3 > = " << std::get< 3 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< 4 > = " << std::get< 4 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< 5 > = " << std::get< 5 >(xtuple) << std::endl;
+ * 
+ *     std::get< nstuple::X_tuple_type_index< int   , 0 >(xtuple) >(xtuple) = 101;
+ *     std::get< nstuple::X_tuple_type_index< int   , 1 >(xtuple) >(xtuple) = 201;
+ *     std::get< nstuple::X_tuple_type_index< int   , 2 >(xtuple) >(xtuple) = 301;
+ *     std::get< nstuple::X_tuple_type_index< char  , 0 >(xtuple) >(xtuple) = 'B';
+ *     std::get< nstuple::X_tuple_type_index< float , 0 >(xtuple) >(xtuple) = 1.245F;
+ *     std::get< nstuple::X_tuple_type_index< double, 0 >(xtuple) >(xtuple) = 1.236;
+ * 
+ *     std::cout << " xtpule< int   , 0 >[0] = " << std::get< 0 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< int   , 1 >[1] = " << std::get< 1 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< int   , 2 >[2] = " << std::get< 2 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< char  , 0 >[3] = " << std::get< 3 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< float , 0 >[4] = " << std::get< 4 >(xtuple) << std::endl;
+ *     std::cout << " xtpule< double, 0 >[5] = " << std::get< 5 >(xtuple) << std::endl;
+ * 
+ *     return 0;
+ * }
+ * </pre>
+ * @endcode
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 
+ * <pre>
+ *   以下为 INVOKE 语义（参看 std::invoke()）的 C++11 实现，以及在 tuple 对象上直接展开参数进行调用的 X_apply()，
+ *   用于取代 std::bind()：既省去 bind 对象的构建与参数拷贝，也便于编译器内联；
+ *   同时支持仅可移动（move-only）的函数对象与参数（如 std::unique_ptr）。
+ * </pre>
+ */
+
+/**
+ * @brief 调用普通的可调用对象（函数、函数指针、函数对象、lambda 表达式）。
+ */
+template< typename _Func, typename... _Args >
+inline auto X_invoke(_Func && xfunc, _Args && ... xargs)
+    -> decltype(std::forward< _Func >(xfunc)(std::forward< _Args >(xargs)...))
+{
+    return std::forward< _Func >(xfunc)(std::forward< _Args >(xargs)...);
+}
+
+/**
+ * @brief 调用成员函数（对象以引用方式给出）。
+ */
+template< typename _Mty, typename _Cls, typename _Obj, typename... _Args,
+          typename = typename std::enable_if< std::is_function< _Mty >::value >::type >
+inline auto X_invoke(_Mty _Cls::* xpmf, _Obj && xobj, _Args && ... xargs)
+    -> decltype((std::forward< _Obj >(xobj).*xpmf)(std::forward< _Args >(xargs)...))
+{
+    return (std::forward< _Obj >(xobj).*xpmf)(std::forward< _Args >(xargs)...);
+}
+
+/**
+ * @brief 调用成员函数（对象以指针或智能指针方式给出）。
+ */
+template< typename _Mty, typename _Cls, typename _Obj, typename... _Args,
+          typename = typename std::enable_if< std::is_function< _Mty >::value >::type >
+inline auto X_invoke(_Mty _Cls::* xpmf, _Obj && xobj, _Args && ... xargs)
+    -> decltype(((*std::forward< _Obj >(xobj)).*xpmf)(std::forward< _Args >(xargs)...))
+{
+    return ((*std::forward< _Obj >(xobj)).*xpmf)(std::forward< _Args >(xargs)...);
+}
+
+/**
+ * @brief 访问数据成员（对象以引用方式给出）。
+ */
+template< typename _Mty, typename _Cls, typename _Obj,
+          typename = typename std::enable_if< !std::is_function< _Mty >::value >::type >
+inline auto X_invoke(_Mty _Cls::* xpmd, _Obj && xobj)
+    -> decltype(std::forward< _Obj >(xobj).*xpmd)
+{
+    return std::forward< _Obj >(xobj).*xpmd;
+}
+
+/**
+ * @brief 访问数据成员（对象以指针或智能指针方式给出）。
+ */
+template< typename _Mty, typename _Cls, typename _Obj,
+          typename = typename std::enable_if< !std::is_function< _Mty >::value >::type >
+inline auto X_invoke(_Mty _Cls::* xpmd, _Obj && xobj)
+    -> decltype((*std::forward< _Obj >(xobj)).*xpmd)
+{
+    return (*std::forward< _Obj >(xobj)).*xpmd;
+}
+
+/**
+ * @brief 调用成员函数或访问数据成员（对象以 std::reference_wrapper 方式给出，如 std::ref(xobj)）。
+ */
+template< typename _Mty, typename _Cls, typename _Ty, typename... _Args >
+inline auto X_invoke(_Mty _Cls::* xpm, std::reference_wrapper< _Ty > xref, _Args && ... xargs)
+    -> decltype(X_invoke(xpm, xref.get(), std::forward< _Args >(xargs)...))
+{
+    return X_invoke(xpm, xref.get(), std::forward< _Args >(xargs)...);
+}
+
+/** 协助 X_is_invocable 进行判断 */
+template< typename _Func, typename... _Args >
+auto X_invocable_test(int)
+    -> decltype(X_invoke(std::declval< _Func >(), std::declval< _Args >()...), std::true_type());
+
+template< typename _Func, typename... _Args >
+std::false_type X_invocable_test(...);
+
+/**
+ * @struct X_is_invocable
+ * @brief  判断 _Func 能否以 _Args... 为参数进行调用（INVOKE 语义）。
+ */
+template< typename _Func, typename... _Args >
+struct X_is_invocable : public decltype(X_invocable_test< _Func, _Args... >(0))
+{
+
+};
+
+/**
+ * @brief 以右值方式传递 tuple 对象内的参数，调用 xfunc。
+ */
+template< typename _Func, typename _Tuple, size_t... _Ind >
+inline auto X_apply_impl(std::true_type, _Func & xfunc, _Tuple & xargs, X_Index_tuple< _Ind... >)
+    -> decltype(X_invoke(xfunc, std::get< _Ind >(std::move(xargs))...))
+{
+    return X_invoke(xfunc, std::get< _Ind >(std::move(xargs))...);
+}
+
+/**
+ * @brief 以左值方式传递 tuple 对象内的参数，调用 xfunc。
+ */
+template< typename _Func, typename _Tuple, size_t... _Ind >
+inline auto X_apply_impl(std::false_type, _Func & xfunc, _Tuple & xargs, X_Index_tuple< _Ind... >)
+    -> decltype(X_invoke(xfunc, std::get< _Ind >(xargs)...))
+{
+    return X_invoke(xfunc, std::get< _Ind >(xargs)...);
+}
+
+/** X_apply_t 的前置声明 */
+template< typename _Func, typename _Tuple >
+struct X_apply_t;
+
+/**
+ * @struct X_apply_t
+ * @brief  X_apply() 的调用方式与返回值类型。
+ * <pre>
+ *   xfunc 可接受右值参数时（如按值传递的 std::unique_ptr 或 std::string），
+ *   以右值方式传递参数（同 std::thread 的语义），免去一次拷贝；
+ *   否则（如形参为非 const 的左值引用），与 std::bind() 相同，以左值方式传递参数。
+ * </pre>
+ */
+template< typename _Func, typename... _Args >
+struct X_apply_t< _Func, std::tuple< _Args... > >
+{
+    using _Rvalue  = typename X_is_invocable< _Func &, _Args &&... >::type;
+    using _Indices = typename X_Build_index_tuple< sizeof...(_Args) >::__type;
+    using type     = decltype(X_apply_impl(_Rvalue(),
+                                           std::declval< _Func & >(),
+                                           std::declval< std::tuple< _Args... > & >(),
+                                           _Indices()));
+};
+
+/**
+ * @brief 展开 tuple 对象内的参数，调用 xfunc（xfunc 以左值方式调用，参数的传递方式参看 X_apply_t）。
+ * @note  以右值方式传递参数后，xargs 内的参数可能已被移走，故只适用于一次性的调用。
+ */
+template< typename _Func, typename _Tuple >
+inline typename X_apply_t< _Func, _Tuple >::type X_apply(_Func & xfunc, _Tuple & xargs)
+{
+    return X_apply_impl(typename X_apply_t< _Func, _Tuple >::_Rvalue(),
+                        xfunc, xargs, typename X_apply_t< _Func, _Tuple >::_Indices());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}; // namaspace nstuple
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 命名空间内定义基于地址的等待/唤醒操作（futex）的辅助接口。
+ * <pre>
+ *   Linux 平台直接使用 futex 系统调用；其他平台以分桶的 互斥锁 + 条件变量 模拟。
+ *   等待方只在 xword 的值等于 xexpected 时进入等待，修改 xword 后再调用唤醒接口，
+ *   即可避免丢失唤醒通知。
+ * </pre>
+ */
+namespace nsfutex
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__linux__)
+
+/**
+ * @struct X_futex_bucket
+ * @brief  模拟 futex 的等待桶（按地址散列）。
+ */
+struct X_futex_bucket
+{
+    std::mutex              m_xlock;
+    std::condition_variable m_xnotifier;
+};
+
+/**
+ * @brief 返回地址所对应的等待桶。
+ */
+inline X_futex_bucket & X_futex_bucket_of(const void * xaddr)
+{
+    static X_futex_bucket _S_buckets[64];
+    size_t xhash = reinterpret_cast< size_t >(xaddr);
+    return _S_buckets[((xhash >> 4) ^ (xhash >> 10)) % 64];
+}
+
+#endif // !defined(__linux__)
+
+/**********************************************************/
+/**
+ * @brief 若 xword 的值等于 xexpected，则等待，直至被唤醒或超时（可能虚假唤醒，调用方需循环检测）。
+ * 
+ * @param [in ] xword      : 等待的原子变量。
+ * @param [in ] xexpected  : 期望值。
+ * @param [in ] xtimeout   : 超时时长（为负值时，不限时）。
+ * 
+ * @return bool
+ *         - 超时，返回 false；
+ *         - 否则，返回 true。
+ */
+inline bool X_futex_wait(std::atomic< uint32_t > & xword,
+                         uint32_t xexpected,
+                         std::chrono::nanoseconds xtimeout = std::chrono::nanoseconds(-1))
+{
+#if defined(__linux__)
+    struct timespec xtspec;
+    struct timespec * xtspec_ptr = nullptr;
+    if (xtimeout.count() >= 0)
+    {
+        xtspec.tv_sec  = static_cast< time_t >(xtimeout.count() / 1000000000);
+        xtspec.tv_nsec = static_cast< long   >(xtimeout.count() % 1000000000);
+        xtspec_ptr = &xtspec;
+    }
+
+    long xret = syscall(SYS_futex, reinterpret_cast< uint32_t * >(&xword),
+                        FUTEX_WAIT_PRIVATE, xexpected, xtspec_ptr, nullptr, 0);
+    return !((-1 == xret) && (ETIMEDOUT == errno));
+#else // !defined(__linux__)
+    X_futex_bucket & xbucket = X_futex_bucket_of(&xword);
+    std::unique_lock< std::mutex > xunique_locker(xbucket.m_xlock);
+    if (xword.load() != xexpected)
+        return true;
+    if (xtimeout.count() < 0)
+    {
+        xbucket.m_xnotifier.wait(xunique_locker);
+        return true;
+    }
+    return (std::cv_status::no_timeout == xbucket.m_xnotifier.wait_for(xunique_locker, xtimeout));
+#endif // defined(__linux__)
+}
+
+/**********************************************************/
+/**
+ * @brief 唤醒一个在 xword 上等待的线程。
+ * @note  非 Linux 平台上，等待桶由多个地址共用，因此唤醒桶内所有的等待方（其余的视为虚假唤醒）。
+ */
+inline void X_futex_wake_one(std::atomic< uint32_t > & xword)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast< uint32_t * >(&xword),
+            FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#else // !defined(__linux__)
+    X_futex_bucket & xbucket = X_futex_bucket_of(&xword);
+    {
+        std::lock_guard< std::mutex > xautolock(xbucket.m_xlock);
+    }
+    xbucket.m_xnotifier.notify_all();
+#endif // defined(__linux__)
+}
+
+/**********************************************************/
+/**
+ * @brief 唤醒所有在 xword 上等待的线程。
+ */
+inline void X_futex_wake_all(std::atomic< uint32_t > & xword)
+{
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast< uint32_t * >(&xword),
+            FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else // !defined(__linux__)
+    X_futex_bucket & xbucket = X_futex_bucket_of(&xword);
+    {
+        std::lock_guard< std::mutex > xautolock(xbucket.m_xlock);
+    }
+    xbucket.m_xnotifier.notify_all();
+#endif // defined(__linux__)
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}; // namespace nsfutex
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief 命名空间内定义绑定工作线程 CPU 亲和性的辅助接口。
+ * <pre>
+ *   Linux 平台以 sched_getaffinity() 获取可用的 CPU 集合，从 sysfs 读取其拓扑信息，
+ *   以 pthread_setaffinity_np() 绑定线程；其他平台上，绑定操作不生效（返回 false）。
+ * </pre>
+ */
+namespace nsaffinity
+{
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @struct X_cpu_info
+ * @brief  逻辑 CPU 的拓扑信息。
+ */
+struct X_cpu_info
+{
+    int m_xcpu;       ///< 逻辑 CPU 编号
+    int m_xpackage;   ///< 所属的物理封装（插槽）编号
+    int m_xcore;      ///< 所属的物理核心编号
+};
+
+/**********************************************************/
+/**
+ * @brief 读取逻辑 CPU 的拓扑信息项（/sys/devices/system/cpu/cpuN/topology/xszt_name），失败时返回 -1。
+ */
+inline int X_read_topology(int xcpu, const char * xszt_name)
+{
+    int xvalue = -1;
+#if defined(__linux__)
+    char xszt_path[128];
+    snprintf(xszt_path, sizeof(xszt_path), "/sys/devices/system/cpu/cpu%d/topology/%s", xcpu, xszt_name);
+
+    FILE * xfile = fopen(xszt_path, "r");
+    if (nullptr != xfile)
+    {
+        if (1 != fscanf(xfile, "%d", &xvalue))
+            xvalue = -1;
+        fclose(xfile);
+    }
+#endif // defined(__linux__)
+    return xvalue;
+}
+
+/**********************************************************/
+/**
+ * @brief 返回当前线程（即进程 cpuset）允许使用的逻辑 CPU 及其拓扑信息（按 CPU 编号升序）。
+ * @note  无法获取时，视为 [0, hardware_concurrency()) 且各自独占一个物理核心。
+ */
+inline std::vector< X_cpu_info > X_allowed_cpus(void)
+{
+    std::vector< X_cpu_info > xvec_cpus;
+
+#if defined(__linux__)
+    cpu_set_t xcpuset;
+    CPU_ZERO(&xcpuset);
+    if (0 == sched_getaffinity(0, sizeof(xcpuset), &xcpuset))
+    {
+        for (int xcpu = 0; xcpu < CPU_SETSIZE; ++xcpu)
+        {
+            if (!CPU_ISSET(xcpu, &xcpuset))
+                continue;
+
+            X_cpu_info xinfo = { xcpu, X_read_topology(xcpu, "physical_package_id"), X_read_topology(xcpu, "core_id") };
+            if (xinfo.m_xpackage < 0)
+                xinfo.m_xpackage = 0;
+            if (xinfo.m_xcore < 0)
+                xinfo.m_xcore = xcpu;
+            xvec_cpus.push_back(xinfo);
+        }
+    }
+#endif // defined(__linux__)
+
+    if (xvec_cpus.empty())
+    {
+        for (int xcpu = 0, xcount = static_cast< int >(std::thread::hardware_concurrency()); xcpu < xcount; ++xcpu)
+        {
+            X_cpu_info xinfo = { xcpu, 0, xcpu };
+            xvec_cpus.push_back(xinfo);
+        }
+    }
+
+    return xvec_cpus;
+}
+
+/**********************************************************/
+/**
+ * @brief 按绑定策略排列逻辑 CPU 的次序（第 i 个工作线程绑定至第 i % size 个）。
+ * 
+ * @param [in ] xvec_cpus : 可用的逻辑 CPU 及其拓扑信息。
+ * @param [in ] xscatter  : 
+ *  - false，紧凑排列：按 封装 -> 核心 -> 超线程 的次序，相邻的工作线程共享核心/缓存；
+ *  - true ，分散排列：先轮流分布于各个封装，再分布于各个核心，最后才使用同一核心的超线程。
+ */
+inline std::vector< int > X_order_cpus(std::vector< X_cpu_info > xvec_cpus, bool xscatter)
+{
+    std::sort(xvec_cpus.begin(), xvec_cpus.end(),
+              [](const X_cpu_info & xleft, const X_cpu_info & xright) -> bool
+              {
+                  if (xleft.m_xpackage != xright.m_xpackage) return (xleft.m_xpackage < xright.m_xpackage);
+                  if (xleft.m_xcore    != xright.m_xcore   ) return (xleft.m_xcore    < xright.m_xcore   );
+                  return (xleft.m_xcpu < xright.m_xcpu);
+              });
+
+    std::vector< int > xvec_order;
+    if (!xscatter)
+    {
+        for (const X_cpu_info & xinfo : xvec_cpus)
+            xvec_order.push_back(xinfo.m_xcpu);
+        return xvec_order;
+    }
+
+    // 计算各个逻辑 CPU 的 超线程序号（核心内） 与 核心序号（封装内），再按 (超线程序号, 核心序号, 封装) 排列
+    struct x_rank_t { size_t m_xsmt; size_t m_xcore; int m_xpackage; int m_xcpu; };
+    std::vector< x_rank_t > xvec_ranks;
+
+    size_t xsmt  = 0;
+    size_t xcore = 0;
+    for (size_t xiter = 0; xiter < xvec_cpus.size(); ++xiter)
+    {
+        const X_cpu_info & xinfo = xvec_cpus[xiter];
+        if (xiter > 0)
+        {
+            const X_cpu_info & xprev = xvec_cpus[xiter - 1];
+            if (xprev.m_xpackage != xinfo.m_xpackage)
+            {
+                xsmt  = 0;
+                xcore = 0;
+            }
+            else if (xprev.m_xcore != xinfo.m_xcore)
+            {
+                xsmt   = 0;
+                xcore += 1;
+            }
+            else
+            {
+                xsmt += 1;
+            }
+        }
+
+        x_rank_t xrank = { xsmt, xcore, xinfo.m_xpackage, xinfo.m_xcpu };
+        xvec_ranks.push_back(xrank);
+    }
+
+    std::stable_sort(xvec_ranks.begin(), xvec_ranks.end(),
+                     [](const x_rank_t & xleft, const x_rank_t & xright) -> bool
+                     {
+                         if (xleft.m_xsmt  != xright.m_xsmt ) return (xleft.m_xsmt  < xright.m_xsmt );
+                         if (xleft.m_xcore != xright.m_xcore) return (xleft.m_xcore < xright.m_xcore);
+                         return (xleft.m_xpackage < xright.m_xpackage);
+                     });
+
+    for (const x_rank_t & xrank : xvec_ranks)
+        xvec_order.push_back(xrank.m_xcpu);
+    return xvec_order;
+}
+
+/**********************************************************/
+/**
+ * @brief 将线程绑定至 xvec_cpus 中的逻辑 CPU 集合。
+ * 
+ * @return bool
+ *         - 成功，返回 true；
+ *         - 失败（或当前平台不支持），返回 false。
+ */
+inline bool X_pin_thread(std::thread & xthread, const std::vector< int > & xvec_cpus)
+{
+#if defined(__linux__)
+    cpu_set_t xcpuset;
+    CPU_ZERO(&xcpuset);
+    for (int xcpu : xvec_cpus)
+    {
+        if ((xcpu >= 0) && (xcpu < CPU_SETSIZE))
+            CPU_SET(xcpu, &xcpuset);
+    }
+
+    return ((CPU_COUNT(&xcpuset) > 0) &&
+            (0 == pthread_setaffinity_np(xthread.native_handle(), sizeof(xcpuset), &xcpuset)));
+#else // !defined(__linux__)
+    return false;
+#endif // defined(__linux__)
+}
+
+/**********************************************************/
+/**
+ * @brief 将当前线程绑定至 xvec_cpus 中的逻辑 CPU 集合（参看 X_pin_thread()）。
+ */
+inline bool X_pin_current(const std::vector< int > & xvec_cpus)
+{
+#if defined(__linux__)
+    cpu_set_t xcpuset;
+    CPU_ZERO(&xcpuset);
+    for (int xcpu : xvec_cpus)
+    {
+        if ((xcpu >= 0) && (xcpu < CPU_SETSIZE))
+            CPU_SET(xcpu, &xcpuset);
+    }
+
+    return ((CPU_COUNT(&xcpuset) > 0) &&
+            (0 == pthread_setaffinity_np(pthread_self(), sizeof(xcpuset), &xcpuset)));
+#else // !defined(__linux__)
+    return false;
+#endif // defined(__linux__)
+}
+
+/**********************************************************/
+/**
+ * @brief 返回当前线程所在的逻辑 CPU 编号（无法获取时，返回 -1）。
+ */
+inline int X_current_cpu(void)
+{
+#if defined(__linux__)
+    return sched_getcpu();
+#else // !defined(__linux__)
+    return -1;
+#endif // defined(__linux__)
+}
+
+/**********************************************************/
+/**
+ * @brief 解析 cpulist 格式的字符串（如 "0-3,8-11"）。
+ */
+inline std::vector< int > X_parse_cpulist(const char * xszt_list)
+{
+    std::vector< int > xvec_cpus;
+
+    while ((nullptr != xszt_list) && ('\0' != *xszt_list))
+    {
+        int xfirst = 0;
+        int xlast  = 0;
+        int xchars = 0;
+        if (2 == sscanf(xszt_list, "%d-%d%n", &xfirst, &xlast, &xchars))
+        {
+        }
+        else if (1 == sscanf(xszt_list, "%d%n", &xfirst, &xchars))
+        {
+            xlast = xfirst;
+        }
+        else
+        {
+            break;
+        }
+
+        for (int xcpu = xfirst; xcpu <= xlast; ++xcpu)
+            xvec_cpus.push_back(xcpu);
+
+        xszt_list += xchars;
+        if (',' != *xszt_list)
+            break;
+        xszt_list += 1;
+    }
+
+    return xvec_cpus;
+}
+
+/**********************************************************/
+/**
+ * @brief 读取 NUMA 拓扑（xszt_root/nodeN/cpulist），返回各个节点上当前线程可用的逻辑 CPU。
+ * @note  没有可用逻辑 CPU 的节点（如只有内存的节点）不计入；无法读取时，视为只有一个节点。
+ */
+inline std::vector< std::vector< int > > X_numa_nodes(const char * xszt_root = "/sys/devices/system/node")
+{
+    std::vector< X_cpu_info > xvec_allowed = X_allowed_cpus();
+    std::vector< std::vector< int > > xvec_nodes;
+
+#if defined(__linux__)
+    for (int xnode = 0, xmissing = 0; xmissing < 64; ++xnode)
+    {
+        char xszt_path[256];
+        snprintf(xszt_path, sizeof(xszt_path), "%s/node%d/cpulist", xszt_root, xnode);
+
+        FILE * xfile = fopen(xszt_path, "r");
+        if (nullptr == xfile)
+        {
+            // 节点编号可能不连续
+            xmissing += 1;
+            continue;
+        }
+
+        char xszt_list[4096] = { 0 };
+        if (nullptr == fgets(xszt_list, sizeof(xszt_list), xfile))
+            xszt_list[0] = '\0';
+        fclose(xfile);
+
+        std::vector< int > xvec_cpus;
+        for (int xcpu : X_parse_cpulist(xszt_list))
+        {
+            for (const X_cpu_info & xinfo : xvec_allowed)
+            {
+                if (xinfo.m_xcpu == xcpu)
+                {
+                    xvec_cpus.push_back(xcpu);
+                    break;
+                }
+            }
+        }
+
+        if (!xvec_cpus.empty())
+            xvec_nodes.push_back(xvec_cpus);
+    }
+#endif // defined(__linux__)
+
+    if (xvec_nodes.empty())
+    {
+        std::vector< int > xvec_cpus;
+        for (const X_cpu_info & xinfo : xvec_allowed)
+            xvec_cpus.push_back(xinfo.m_xcpu);
+        xvec_nodes.push_back(xvec_cpus);
+    }
+
+    return xvec_nodes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}; // namespace nsaffinity
+
+////////////////////////////////////////////////////////////////////////////////
+// x_threadpool_t
+
+/**
+ * @class x_threadpool_t
+ * @brief 线程池类。
+ */
+class x_threadpool_t
+{
+    // common data types
+private:
+    using x_locker_t = std::mutex;
+
+    /** 前置声明 */
+    struct x_strand_t;
+    struct x_timer_node_t;
+    class  x_timer_wheel_t;
+
+public:
+    /** 前置声明 */
+    struct x_running_checker_t;
+    struct x_task_deleter_t;
+    class  x_task_group_t;
+
+    /**
+     * @struct x_task_t
+     * @brief  任务对象的抽象基类。
+     * @note   参看 @see get_deleter() 接口的说明。
+     */
+    struct x_task_t
+    {
+        friend x_threadpool_t;
+
+        // constructor/destructor
+    public:
+        x_task_t(void) : m_xnext_task(nullptr), m_xstrand_ptr(nullptr), m_xcap_bytes(0), m_xgroup_ptr(nullptr), m_xtm_enqueue(0) { }
+        x_task_t(const x_task_t & xobject) : m_xnext_task(nullptr), m_xstrand_ptr(nullptr), m_xcap_bytes(0), m_xgroup_ptr(nullptr), m_xtm_enqueue(0) { }
+        x_task_t & operator=(const x_task_t & xobject) { return *this; }
+        virtual ~x_task_t(void) { }
+
+        // extensible interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 任务对象执行流程的抽象接口。
+         */
+        virtual void run(x_running_checker_t * xchecker_ptr) = 0;
+
+        /**********************************************************/
+        /**
+         * @brief 判断 任务对象 是否挂起。
+         * @note
+         * <pre>
+         *   在启动线程池时，若选择检测任务对象的挂起状态，该接口有效。
+         *   即，任务对象处于挂起状态，工作线程提取任务时，则跳过该对象。
+         * </pre>
+         */
+        virtual bool is_suspend(void) const { return false; }
+
+        /**********************************************************/
+        /**
+         * @brief 设置任务对象的运行标识。
+         * 
+         * @note
+         * <pre>
+         *   工作线程在提取到任务对象后，则立即调用 set_running_flag(true) 操作；
+         *   执行 run() 操作返回后，又调用 set_running_flag(false) 操作。
+         * </pre>
+         */
+        virtual void set_running_flag(bool xrunning_flag) { }
+
+        /**********************************************************/
+        /**
+         * @brief 获取任务对象的删除器，重载该接口，可实现自定义的任务对象回收方式。
+         * 
+         * @note
+         * <pre>
+         *   任务对象提交至线程池后，工作线程会调用任务对象的 run() 
+         *   接口执行具体的任务操作流程，run() 接口返回后，
+         *   线程池的工作线程会调用该接口，获取任务对象的删除器，
+         *   然后使用 删除器 对 任务对象 进行资源回收操作。
+         *   重载该接口，获取自定义的删除器对象，则可实现自定义的资源回收方式。
+         * </pre>
+         */
+        virtual const x_task_deleter_t * get_deleter(void) const
+        {
+            return &x_threadpool_t::_S_task_common_deleter;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 任务对象所占用内存的估算值（字节数）。
+         * @note  启用 x_config_t::max_bytes 容量限制时，以该值进行统计；重载该接口，可计入任务对象额外持有的内存。
+         */
+        virtual size_t estimated_size(void) const
+        {
+            return sizeof(x_task_t);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 追踪记录中的任务标签（参看 x_threadpool_t::start_trace()；返回的字符串须在导出前一直有效）。
+         * @note  只在记录追踪记录时调用；执行过程中以 x_threadpool_t::set_trace_label() 设置的标签优先。
+         */
+        virtual const char * trace_label(void) const
+        {
+            return nullptr;
+        }
+
+        // data members
+    private:
+        std::atomic< x_task_t * > m_xnext_task;   ///< 侵入式任务队列的链接指针（由线程池内部使用）
+        x_strand_t *              m_xstrand_ptr;  ///< 所属的串行执行序列（参看 submit_ordered() 接口）
+        size_t                    m_xcap_bytes;   ///< 计入容量统计的字节数（为 0 时，表示未计入）
+        x_task_group_t *          m_xgroup_ptr;   ///< 所属的任务组（参看 x_task_group_t）
+        uint64_t                  m_xtm_enqueue;  ///< 入队的时间点（纳秒；为 0 时未记录，参看 x_config_t::timing_metrics）
+    };
+
+    /** 任务对象指针类型 */
+    using x_task_ptr_t = x_task_t *;
+
+    /**
+     * @struct x_running_checker_t
+     * @brief  辅助 x_task_t 对象进行回调判断线程池是否可继续运行，以便于对任务执行流程进行终止操作。
+     */
+    struct x_running_checker_t final
+    {
+        friend x_threadpool_t;
+
+        // constructor/destructor
+    private:
+        x_running_checker_t(const x_threadpool_t * xthis_pool_ptr,
+                            size_t xthread_index,
+                            const std::atomic< int > * xcpu_ptr = nullptr)
+            : m_this_pool_ptr(xthis_pool_ptr)
+            , m_xthread_index(xthread_index)
+            , m_xcpu_ptr(xcpu_ptr)
+        {
+        }
+
+        ~x_running_checker_t(void)
+        {
+        }
+
+        x_running_checker_t(x_running_checker_t && xobject) = delete;
+        x_running_checker_t & operator=(x_running_checker_t && xobject) = delete;
+        x_running_checker_t(const x_running_checker_t & xobject) = delete;
+        x_running_checker_t & operator=(const x_running_checker_t & xobject) = delete;
+
+        // common data types
+    public:
+        using x_holder_t = x_running_checker_t *;
+
+        /**********************************************************/
+        /**
+         * @brief 返回 x_running_checker_t 的占位对象。
+         * @note  参看 x_threadpool_t::submit_task_ex() 接口的使用说明。
+         */
+        static inline const x_holder_t xholder(void) { return nullptr; };
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 回调判断当前工作线程是否可继续运行。
+         * @note  resize() 减少工作线程数量时，只退出处于任务对象之间的工作线程，不会中止执行中的任务对象；
+         *        只有 shutdown()（或 resize(0)）时，才返回 false。
+         */
+        inline bool is_enable_running(void) const
+        {
+            return m_this_pool_ptr->is_enable_running();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 返回所属的线程索引号。
+         */
+        inline size_t thread_index(void) const
+        {
+            return m_xthread_index;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 返回所属工作线程绑定的逻辑 CPU 编号（未绑定至单个 CPU 时，返回 -1）。
+         * @note  参看 x_config_t::affinity_policy 。
+         */
+        inline int pinned_cpu(void) const
+        {
+            return (nullptr != m_xcpu_ptr) ? m_xcpu_ptr->load(std::memory_order_relaxed) : -1;
+        }
+
+        // data members
+    private:
+        const x_threadpool_t * m_this_pool_ptr;  ///< 所属的线程池对象
+        const size_t           m_xthread_index;  ///< 所属的线程索引号
+        const std::atomic< int > *
+                               m_xcpu_ptr;       ///< 所属工作线程绑定的逻辑 CPU 编号
+    };
+
+    /**
+     * @struct x_task_deleter_t
+     * @brief  任务对象的删除器接口类。
+     */
+    struct x_task_deleter_t
+    {
+        // extensible interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 对 任务对象 进行资源回收操作（删除操作）。
+         */
+        virtual void delete_task(x_task_ptr_t xtask_ptr)
+        {
+            if (nullptr != xtask_ptr)
+                delete xtask_ptr;
+        }
+    };
+
+    /**
+     * @enum  x_overflow_policy_t
+     * @brief 任务对象数量（或内存估算值）达到容量上限时，提交操作的处理策略。
+     */
+    enum x_overflow_policy_t
+    {
+        ECV_OVERFLOW_BLOCK       = 0,  ///< 阻塞提交方线程，直至有空闲容量（工作线程提交时，改为 ECV_OVERFLOW_CALLER_RUNS）
+        ECV_OVERFLOW_CALLER_RUNS = 1,  ///< 在提交方线程中直接执行该任务对象
+        ECV_OVERFLOW_DROP_OLDEST = 2,  ///< 丢弃最早入队（尚未执行）的任务对象，腾出容量
+    };
+
+    /**
+     * @enum  x_idle_policy_t
+     * @brief 任务队列非空，但工作线程提取不到可执行的任务对象时（如任务对象均处于挂起状态），
+     *        工作线程的退避策略（参看 x_idle_backoff_t）。
+     */
+    enum x_idle_policy_t
+    {
+        ECV_IDLE_ADAPTIVE = 0,  ///< 自旋（轮数按命中情况自适应）→ 让出时间片 → 挂起等待，直至被唤醒
+        ECV_IDLE_SPIN     = 1,  ///< 自旋 → 持续让出时间片，不挂起（时延最低，但持续占用 CPU）
+        ECV_IDLE_YIELD    = 2,  ///< 让出时间片 16 次后休眠 1 毫秒，如此往复（早期版本的策略）
+        ECV_IDLE_PARK     = 3,  ///< 直接挂起等待，直至被唤醒（不占用 CPU）
+    };
+
+    /**
+     * @enum  x_affinity_policy_t
+     * @brief 工作线程的 CPU 亲和性（绑定）策略（只在 Linux 平台上生效）。
+     */
+    enum x_affinity_policy_t
+    {
+        ECV_AFFINITY_NONE    = 0,  ///< 不绑定，由操作系统调度
+        ECV_AFFINITY_COMPACT = 1,  ///< 紧凑绑定：相邻的工作线程绑定至同一核心/封装内相邻的逻辑 CPU
+        ECV_AFFINITY_SCATTER = 2,  ///< 分散绑定：工作线程轮流分布于各个封装、各个核心，最后才使用超线程
+        ECV_AFFINITY_LIST    = 3,  ///< 按 x_config_t::affinity_cpus 列出的逻辑 CPU 依次绑定
+        ECV_AFFINITY_CPUSET  = 4,  ///< 每个工作线程都限定在启动时进程可用的 CPU 集合内（不绑定至单个 CPU）
+    };
+
+    /**
+     * @struct x_config_t
+     * @brief  线程池的启动参数（参看 startup(const x_config_t &) 接口）。
+     */
+    struct x_config_t
+    {
+        size_t xthds;           ///< 工作线程的数量（若为 0，将取 hardware_concurrency() 返回值的 2倍 + 1）
+        bool   check_suspened;  ///< 是否检测任务对象的挂起状态
+        bool   work_stealing;   ///< 是否启用工作窃取的调度模式（与 check_suspened 不可同时启用，后者优先）
+        size_t ring_capacity;   ///< 无锁环形提交队列的容量（为 0 时不启用；向上取 2 的幂；check_suspened 时无效）
+        size_t priorities;      ///< 任务对象的优先级数量（优先级取值 [0, priorities)，数值越大越优先；为 0 时视为 1）
+        size_t aging_quota;     ///< 低优先级任务对象被连续跳过多少次后，优先执行一次（为 0 时不做老化处理）
+        size_t max_tasks;       ///< 任务对象数量的容量上限（已提交、尚未执行完成的；为 0 时不限制）
+        size_t max_bytes;       ///< 任务对象内存估算值的容量上限（参看 x_task_t::estimated_size()；为 0 时不限制）
+        x_overflow_policy_t overflow_policy;  ///< 达到容量上限时，提交操作的处理策略
+        x_idle_policy_t     idle_policy;      ///< 提取不到可执行的任务对象时，工作线程的退避策略
+
+        size_t min_threads;     ///< 弹性模式下，工作线程的下限数量（不小于 1）
+        size_t max_threads;     ///< 弹性模式下，工作线程的上限数量（为 0 时不启用弹性模式）
+        size_t scale_up_depth;  ///< 任务队列中的对象数量持续不小于该值时，增加工作线程（为 0 时不按此判断）
+        std::chrono::microseconds scale_up_sojourn;  ///< 估算的排队时长持续不小于该值时，增加工作线程（为 0 时不按此判断）
+        std::chrono::milliseconds scale_interval;    ///< 弹性模式下，控制线程的检测周期
+        std::chrono::milliseconds keep_alive;        ///< 弹性模式下，空闲超过该时长的工作线程退出（不低于 min_threads）
+
+        x_affinity_policy_t affinity_policy;  ///< 工作线程的 CPU 亲和性策略
+        std::vector< int >  affinity_cpus;    ///< ECV_AFFINITY_LIST 策略下，第 i 个工作线程绑定至 affinity_cpus[i % size]
+        bool                numa_aware;       ///< 是否启用 NUMA 模式（隐含启用 work_stealing；启用后 affinity_policy 无效）
+
+        bool   timing_metrics;  ///< 是否统计时长类的运行指标（参看 snapshot()；每个任务对象多读取约 3 次时钟）
+
+        x_config_t(void)
+            : xthds(0)
+            , check_suspened(false)
+            , work_stealing(false)
+            , ring_capacity(0)
+            , priorities(1)
+            , aging_quota(32)
+            , max_tasks(0)
+            , max_bytes(0)
+            , overflow_policy(ECV_OVERFLOW_BLOCK)
+            , idle_policy(ECV_IDLE_ADAPTIVE)
+            , min_threads(1)
+            , max_threads(0)
+            , scale_up_depth(16)
+            , scale_up_sojourn(10000)
+            , scale_interval(10)
+            , keep_alive(60000)
+            , affinity_policy(ECV_AFFINITY_NONE)
+            , numa_aware(false)
+            , timing_metrics(false)
+        {
+
+        }
+    };
+
+    /**
+     * @class x_timer_t
+     * @brief 定时器的句柄（参看 submit_after()、submit_at()、submit_every() 接口）。
+     * @note
+     * <pre>
+     *   句柄以引用计数共享定时器对象，可复制；句柄销毁（或 reset()）并不取消定时器。
+     *   cancel() 操作不可与线程池对象的析构操作并发进行。
+     * </pre>
+     */
+    class x_timer_t
+    {
+        friend x_threadpool_t;
+
+        // constructor/destructor
+    public:
+        x_timer_t(void) : m_xnode_ptr(nullptr) { }
+
+        x_timer_t(const x_timer_t & xobject) : m_xnode_ptr(xobject.m_xnode_ptr)
+        {
+            if (nullptr != m_xnode_ptr)
+                m_xnode_ptr->add_ref();
+        }
+
+        x_timer_t(x_timer_t && xobject) : m_xnode_ptr(xobject.m_xnode_ptr)
+        {
+            xobject.m_xnode_ptr = nullptr;
+        }
+
+        x_timer_t & operator=(x_timer_t xobject)
+        {
+            std::swap(m_xnode_ptr, xobject.m_xnode_ptr);
+            return *this;
+        }
+
+        ~x_timer_t(void)
+        {
+            reset();
+        }
+
+    private:
+        explicit x_timer_t(x_timer_node_t * xnode_ptr) : m_xnode_ptr(xnode_ptr)
+        {
+
+        }
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 取消定时器（O(1) 操作）。
+         * 
+         * @return bool
+         *         - 定时器尚未到期（周期定时器则为尚未取消），成功取消时，返回 true；
+         *         - 否则，返回 false。
+         * 
+         * @note 已到期但尚未开始执行的回调操作，也会被跳过。
+         */
+        bool cancel(void)
+        {
+            if (nullptr == m_xnode_ptr)
+                return false;
+
+            x_timer_wheel_t * xwheel_ptr = m_xnode_ptr->m_xwheel_ptr.load();
+            if (nullptr != xwheel_ptr)
+                return xwheel_ptr->cancel(m_xnode_ptr);
+
+            m_xnode_ptr->m_xcancelled.store(true, std::memory_order_release);
+            return false;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 句柄是否关联了定时器。
+         */
+        inline bool is_valid(void) const { return (nullptr != m_xnode_ptr); }
+
+        /**********************************************************/
+        /**
+         * @brief 定时器是否已被取消。
+         */
+        inline bool is_cancelled(void) const
+        {
+            return ((nullptr != m_xnode_ptr) && m_xnode_ptr->m_xcancelled.load(std::memory_order_acquire));
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 解除句柄与定时器的关联（不取消定时器）。
+         */
+        void reset(void)
+        {
+            if (nullptr != m_xnode_ptr)
+            {
+                m_xnode_ptr->release();
+                m_xnode_ptr = nullptr;
+            }
+        }
+
+        // data members
+    private:
+        x_timer_node_t * m_xnode_ptr;  ///< 关联的定时器对象（持有其一个引用）
+    };
+
+private:
+    /** 任务对象的通用删除器 */
+    static x_task_deleter_t _S_task_common_deleter;
+
+public:
+    /**
+     * @struct x_alloc_stats_t
+     * @brief  内部任务对象分配器的统计值（参看 alloc_stats() 接口）。
+     */
+    struct x_alloc_stats_t
+    {
+        size_t hits;       ///< 由缓存（线程本地链表或共享链表）满足的分配次数
+        size_t misses;     ///< 缓存为空（或超出分级上限），调用全局 operator new 的分配次数
+        size_t releases;   ///< 超出缓存上限（或超出分级上限），调用全局 operator delete 的释放次数
+    };
+
+    /**
+     * @struct x_worker_metrics_t
+     * @brief  工作线程的运行统计（参看 snapshot() 接口；均为累计值）。
+     * @note   时长类的统计值（*_ns 与直方图）只在启用 x_config_t::timing_metrics 时累计。
+     */
+    struct x_worker_metrics_t
+    {
+        enum
+        {
+            ECV_HIST_BUCKETS = 24,  ///< 直方图的分桶数量（第 i 个桶的上界为 2^i 微秒，最后一个桶不设上界）
+        };
+
+        size_t   thread_index;   ///< 线程索引号（汇总值中为 0）
+        uint64_t tasks;          ///< 执行完成的任务对象数量
+        uint64_t busy_ns;        ///< 执行任务对象（含收尾操作）的时长
+        uint64_t idle_ns;        ///< 其余的运行时长（提取、等待任务对象等）
+        uint64_t parks;          ///< 挂起等待的次数（空闲等待，以及退避时的挂起等待）
+        uint64_t wakeups;        ///< 空闲等待中被唤醒的次数（不含超时）
+        uint64_t get_failures;   ///< 提取不到任务对象的次数
+        uint64_t suspend_skips;  ///< 提取时跳过挂起的任务对象的次数（check_suspened 模式）
+        uint64_t steals;         ///< 从其他工作线程窃取到任务对象的次数（工作窃取模式）
+        uint64_t sojourn_ns;     ///< 任务对象排队（入队至开始执行）的时长之和
+        uint64_t sojourn_hist[ECV_HIST_BUCKETS];  ///< 排队时长的直方图
+        uint64_t run_hist[ECV_HIST_BUCKETS];      ///< 执行时长的直方图（时长之和即 busy_ns）
+
+        x_worker_metrics_t(void)
+            : thread_index(0), tasks(0), busy_ns(0), idle_ns(0), parks(0), wakeups(0)
+            , get_failures(0), suspend_skips(0), steals(0), sojourn_ns(0)
+        {
+            for (size_t xiter = 0; xiter < ECV_HIST_BUCKETS; ++xiter)
+            {
+                sojourn_hist[xiter] = 0;
+                run_hist[xiter]     = 0;
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 累加另一组统计值（thread_index 不变）。
+         */
+        void merge(const x_worker_metrics_t & xmetrics)
+        {
+            tasks         += xmetrics.tasks;
+            busy_ns       += xmetrics.busy_ns;
+            idle_ns       += xmetrics.idle_ns;
+            parks         += xmetrics.parks;
+            wakeups       += xmetrics.wakeups;
+            get_failures  += xmetrics.get_failures;
+            suspend_skips += xmetrics.suspend_skips;
+            steals        += xmetrics.steals;
+            sojourn_ns    += xmetrics.sojourn_ns;
+            for (size_t xiter = 0; xiter < ECV_HIST_BUCKETS; ++xiter)
+            {
+                sojourn_hist[xiter] += xmetrics.sojourn_hist[xiter];
+                run_hist[xiter]     += xmetrics.run_hist[xiter];
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 时长（纳秒）所属的直方图分桶。
+         */
+        static inline size_t bucket_of(uint64_t xns)
+        {
+            size_t xbucket = 0;
+            for (uint64_t xbound = 1000; (xns > xbound) && (xbucket < ECV_HIST_BUCKETS - 1); xbound <<= 1)
+                xbucket += 1;
+            return xbucket;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 直方图分桶的上界（纳秒；最后一个桶返回 UINT64_MAX）。
+         */
+        static inline uint64_t bucket_bound(size_t xbucket)
+        {
+            return (xbucket < ECV_HIST_BUCKETS - 1) ? (static_cast< uint64_t >(1000) << xbucket) : UINT64_MAX;
+        }
+    };
+
+    /**
+     * @struct x_metrics_t
+     * @brief  线程池的运行统计（参看 snapshot() 接口）。
+     */
+    struct x_metrics_t
+    {
+        uint64_t elapsed_ns;     ///< 自线程池对象创建以来的时长
+        uint64_t submitted;      ///< 入队的任务对象数量（不含在提交方线程中直接执行的）
+        uint64_t completed;      ///< 工作线程执行完成的任务对象数量
+        size_t   threads;        ///< 运行中的工作线程数量（参看 size()）
+        size_t   idle_threads;   ///< 处于等待状态的工作线程数量（参看 idle_count()）
+        size_t   pending;        ///< 任务对象总数量（参看 task_count()）
+        bool     timing;         ///< 是否统计了时长类的运行指标（参看 x_config_t::timing_metrics）
+        x_worker_metrics_t total;                   ///< 所有工作线程（包括已停止的）的汇总值
+        std::vector< x_worker_metrics_t > workers;  ///< 各个工作线程槽位的统计值（按线程索引号排列）
+
+        x_metrics_t(void)
+            : elapsed_ns(0), submitted(0), completed(0), threads(0), idle_threads(0), pending(0), timing(false)
+        {
+
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 自 xprev（较早的快照）以来，每秒入队/执行完成的任务对象数量。
+         */
+        double submit_rate(const x_metrics_t & xprev) const
+        {
+            return rate(submitted, xprev.submitted, xprev.elapsed_ns);
+        }
+
+        double complete_rate(const x_metrics_t & xprev) const
+        {
+            return rate(completed, xprev.completed, xprev.elapsed_ns);
+        }
+
+    private:
+        double rate(uint64_t xcount, uint64_t xprev_count, uint64_t xprev_ns) const
+        {
+            if ((elapsed_ns <= xprev_ns) || (xcount < xprev_count))
+                return 0.0;
+            return static_cast< double >(xcount - xprev_count) * 1.0e9 / static_cast< double >(elapsed_ns - xprev_ns);
+        }
+    };
+
+private:
+    /**
+     * @struct x_task_alloc_t
+     * @brief  内部任务对象的分级分配器（作为基类，提供类级别的 operator new/delete）。
+     * @note
+     * <pre>
+     *   按 ECV_GRANULE 字节分级（超出 ECV_GRANULE * ECV_CLASSES 字节的直接使用全局堆）；
+     *   任务对象带有虚析构函数，delete 时传入的是实际类型的大小，因此内存块无需额外的头部，
+     *   线程池回收任务对象的通用删除器（_S_task_common_deleter）也就直接使用本分配器。
+     *   1. 各个线程（提交方线程与工作线程）按分级缓存本线程释放的内存块（最多 ECV_LOCAL_CACHED 个）；
+     *   2. 超出时，将较早的一半整批归还至该分级的共享链表（只入栈、整体出栈，不存在 ABA 问题）；
+     *   3. 线程本地的缓存为空时，一次取走该分级的整个共享链表；
+     *   4. 共享链表的数量（近似值）超出 ECV_SHARED_CACHED 时，归还的内存块直接释放。
+     *   因此，提交方线程分配、工作线程释放的稳态下，不再调用 malloc/free。
+     *   统计值先累计在线程本地，整批操作时（以及每 ECV_STATS_FLUSH 次操作）合并至全局计数。
+     * </pre>
+     */
+    struct x_task_alloc_t
+    {
+        // common data types
+    private:
+        enum
+        {
+            ECV_GRANULE       = 64,     ///< 分级的粒度（字节数）
+            ECV_CLASSES       = 8,      ///< 分级数量
+            ECV_LOCAL_CACHED  = 256,    ///< 每一分级线程本地最多缓存的内存块数量
+            ECV_SHARED_CACHED = 16384,  ///< 每一分级共享链表最多缓存的内存块数量（近似值）
+            ECV_STATS_FLUSH   = 1024,   ///< 线程本地的统计值合并至全局计数的操作次数间隔
+        };
+
+        /** 线程本地缓存的状态（线程退出、已析构后，再分配/释放时直接使用全局堆） */
+        enum
+        {
+            ECV_LOCAL_NONE  = 0,   ///< 尚未构造
+            ECV_LOCAL_ALIVE = 1,   ///< 可用
+            ECV_LOCAL_DEAD  = 2,   ///< 已析构
+        };
+
+        /**
+         * @struct x_free_t
+         * @brief  缓存的内存块（复用其起始位置作为链接指针）。
+         */
+        struct x_free_t
+        {
+            x_free_t * m_xnext;
+        };
+
+        /**
+         * @struct x_cache_t
+         * @brief  线程本地某一分级的缓存。
+         */
+        struct x_cache_t
+        {
+            x_free_t * m_xhead;    ///< 本线程释放的内存块
+            size_t     m_xcount;   ///< m_xhead 链表中的内存块数量
+            x_free_t * m_xbatch;   ///< 从共享链表整批取走的内存块（不计数）
+        };
+
+        /**
+         * @struct x_depot_t
+         * @brief  某一分级的共享链表（独占缓存行）。
+         */
+        struct alignas(64) x_depot_t
+        {
+            std::atomic< x_free_t * > m_xlist;    ///< 链表头
+            std::atomic< size_t >     m_xcount;   ///< 链表中的内存块数量（近似值）
+        };
+
+        /**
+         * @struct x_counter_t
+         * @brief  全局的统计计数。
+         */
+        struct x_counter_t
+        {
+            std::atomic< size_t > m_xhits;
+            std::atomic< size_t > m_xmisses;
+            std::atomic< size_t > m_xreleases;
+        };
+
+        /**
+         * @struct x_local_t
+         * @brief  线程本地的缓存（线程退出时，整体归还至共享链表，并合并统计值）。
+         */
+        struct x_local_t
+        {
+            x_local_t(void) : m_xhits(0), m_xmisses(0), m_xreleases(0), m_xops(0)
+            {
+                local_state() = ECV_LOCAL_ALIVE;
+                for (size_t xiter = 0; xiter < ECV_CLASSES; ++xiter)
+                {
+                    m_xcaches[xiter].m_xhead  = nullptr;
+                    m_xcaches[xiter].m_xcount = 0;
+                    m_xcaches[xiter].m_xbatch = nullptr;
+                }
+            }
+
+            ~x_local_t(void)
+            {
+                for (size_t xiter = 0; xiter < ECV_CLASSES; ++xiter)
+                {
+                    push_depot(xiter, m_xcaches[xiter].m_xhead);
+                    push_depot(xiter, m_xcaches[xiter].m_xbatch);
+                }
+
+                flush_stats();
+                local_state() = ECV_LOCAL_DEAD;
+            }
+
+            /**********************************************************/
+            /**
+             * @brief 将本地的统计值合并至全局计数。
+             */
+            void flush_stats(void)
+            {
+                x_counter_t & xcounter = counter();
+                if (0 != m_xhits    ) xcounter.m_xhits    .fetch_add(m_xhits    , std::memory_order_relaxed);
+                if (0 != m_xmisses  ) xcounter.m_xmisses  .fetch_add(m_xmisses  , std::memory_order_relaxed);
+                if (0 != m_xreleases) xcounter.m_xreleases.fetch_add(m_xreleases, std::memory_order_relaxed);
+                m_xhits = m_xmisses = m_xreleases = m_xops = 0;
+            }
+
+            inline void count_op(void)
+            {
+                if (++m_xops >= ECV_STATS_FLUSH)
+                    flush_stats();
+            }
+
+            x_cache_t m_xcaches[ECV_CLASSES];   ///< 各个分级的缓存
+            size_t    m_xhits;                  ///< 本地累计的命中次数
+            size_t    m_xmisses;                ///< 本地累计的未命中次数
+            size_t    m_xreleases;              ///< 本地累计的释放次数
+            size_t    m_xops;                   ///< 上次合并后的操作次数
+        };
+
+        // public interfaces
+    public:
+        static void * operator new(size_t xsize)
+        {
+            x_local_t * xlocal_ptr = local();
+            if ((nullptr == xlocal_ptr) || (xsize > ECV_GRANULE * ECV_CLASSES))
+            {
+                counter().m_xmisses.fetch_add(1, std::memory_order_relaxed);
+                return ::operator new(class_size(xsize));
+            }
+
+            x_local_t & xlocal = *xlocal_ptr;
+            xlocal.count_op();
+
+            size_t      xclass = (xsize + ECV_GRANULE - 1) / ECV_GRANULE - 1;
+            x_cache_t & xcache = xlocal.m_xcaches[xclass];
+
+            // 优先使用本线程刚释放的（仍在 CPU 缓存中）
+            x_free_t * xfree_ptr = xcache.m_xhead;
+            if (nullptr != xfree_ptr)
+            {
+                xcache.m_xhead   = xfree_ptr->m_xnext;
+                xcache.m_xcount -= 1;
+                xlocal.m_xhits  += 1;
+                return static_cast< void * >(xfree_ptr);
+            }
+
+            xfree_ptr = xcache.m_xbatch;
+            if (nullptr == xfree_ptr)
+            {
+                // 整批取走共享链表
+                x_depot_t & xdepot = depot(xclass);
+                xfree_ptr = xdepot.m_xlist.exchange(nullptr, std::memory_order_acquire);
+                if (nullptr == xfree_ptr)
+                {
+                    xlocal.m_xmisses += 1;
+                    return ::operator new(class_size(xsize));
+                }
+
+                xdepot.m_xcount.store(0, std::memory_order_relaxed);
+            }
+
+            xcache.m_xbatch  = xfree_ptr->m_xnext;
+            xlocal.m_xhits  += 1;
+            return static_cast< void * >(xfree_ptr);
+        }
+
+        static void operator delete(void * xptr, size_t xsize)
+        {
+            if (nullptr == xptr)
+                return;
+
+            x_local_t * xlocal_ptr = local();
+            if ((nullptr == xlocal_ptr) || (xsize > ECV_GRANULE * ECV_CLASSES))
+            {
+                counter().m_xreleases.fetch_add(1, std::memory_order_relaxed);
+                ::operator delete(xptr);
+                return;
+            }
+
+            x_local_t & xlocal = *xlocal_ptr;
+            xlocal.count_op();
+
+            size_t      xclass    = (xsize + ECV_GRANULE - 1) / ECV_GRANULE - 1;
+            x_cache_t & xcache    = xlocal.m_xcaches[xclass];
+            x_free_t  * xfree_ptr = ::new (xptr) x_free_t;
+
+            xfree_ptr->m_xnext = xcache.m_xhead;
+            xcache.m_xhead     = xfree_ptr;
+            if (++xcache.m_xcount < ECV_LOCAL_CACHED)
+            {
+                return;
+            }
+
+            // 保留较新的一半（仍在 CPU 缓存中），较早的一半整批归还
+            x_free_t * xlast_ptr = xcache.m_xhead;
+            for (size_t xiter = 1; xiter < ECV_LOCAL_CACHED / 2; ++xiter)
+            {
+                xlast_ptr = xlast_ptr->m_xnext;
+            }
+
+            x_free_t * xspill_ptr = xlast_ptr->m_xnext;
+            xlast_ptr->m_xnext = nullptr;
+            xcache.m_xcount    = ECV_LOCAL_CACHED / 2;
+
+            if (depot(xclass).m_xcount.load(std::memory_order_relaxed) < ECV_SHARED_CACHED)
+            {
+                push_depot(xclass, xspill_ptr);
+                xlocal.flush_stats();
+                return;
+            }
+
+            while (nullptr != xspill_ptr)
+            {
+                x_free_t * xnext_ptr = xspill_ptr->m_xnext;
+                ::operator delete(static_cast< void * >(xspill_ptr));
+                xspill_ptr = xnext_ptr;
+                xlocal.m_xreleases += 1;
+            }
+            xlocal.flush_stats();
+        }
+
+#if defined(__cpp_aligned_new)
+        /**
+         * 超出默认对齐要求的任务对象（如 alignas(128) 的结果类型、函数对象）不经由分级缓存
+         * （缓存的内存块只保证默认对齐），直接使用全局堆的对齐版本。
+         */
+        static void * operator new(size_t xsize, std::align_val_t xalign)
+        {
+            counter().m_xmisses.fetch_add(1, std::memory_order_relaxed);
+            return ::operator new(xsize, xalign);
+        }
+
+        static void operator delete(void * xptr, std::align_val_t xalign)
+        {
+            if (nullptr == xptr)
+                return;
+            counter().m_xreleases.fetch_add(1, std::memory_order_relaxed);
+            ::operator delete(xptr, xalign);
+        }
+
+        static void operator delete(void * xptr, size_t xsize, std::align_val_t xalign)
+        {
+            operator delete(xptr, xalign);
+        }
+#endif // defined(__cpp_aligned_new)
+
+        /**********************************************************/
+        /**
+         * @brief 读取全局的统计值（不含其他线程尚未合并的部分，最多 ECV_STATS_FLUSH 次操作）。
+         */
+        static x_alloc_stats_t stats(void)
+        {
+            x_local_t * xlocal_ptr = local();
+            if (nullptr != xlocal_ptr)
+                xlocal_ptr->flush_stats();
+
+            x_counter_t & xcounter = counter();
+            x_alloc_stats_t xstats;
+            xstats.hits     = xcounter.m_xhits    .load(std::memory_order_relaxed);
+            xstats.misses   = xcounter.m_xmisses  .load(std::memory_order_relaxed);
+            xstats.releases = xcounter.m_xreleases.load(std::memory_order_relaxed);
+            return xstats;
+        }
+
+        // internal invoking
+    private:
+        static inline int & local_state(void)
+        {
+            static thread_local int _S_state = ECV_LOCAL_NONE;
+            return _S_state;
+        }
+
+        static inline x_local_t * local(void)
+        {
+            if (ECV_LOCAL_DEAD == local_state())
+                return nullptr;
+
+            static thread_local x_local_t _S_local;
+            return &_S_local;
+        }
+
+        /** 内存块的实际大小（分级内的，按分级的上限分配，以便缓存后复用） */
+        static inline size_t class_size(size_t xsize)
+        {
+            if (xsize > ECV_GRANULE * ECV_CLASSES)
+                return xsize;
+            return ((xsize + ECV_GRANULE - 1) / ECV_GRANULE) * ECV_GRANULE;
+        }
+
+        static inline x_depot_t & depot(size_t xclass)
+        {
+            static x_depot_t _S_depots[ECV_CLASSES];
+            return _S_depots[xclass];
+        }
+
+        static inline x_counter_t & counter(void)
+        {
+            static x_counter_t _S_counter;
+            return _S_counter;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将整条链表（以 nullptr 结尾）压入某一分级的共享链表。
+         */
+        static void push_depot(size_t xclass, x_free_t * xhead_ptr)
+        {
+            if (nullptr == xhead_ptr)
+                return;
+
+            size_t     xcount    = 1;
+            x_free_t * xtail_ptr = xhead_ptr;
+            while (nullptr != xtail_ptr->m_xnext)
+            {
+                xtail_ptr = xtail_ptr->m_xnext;
+                xcount   += 1;
+            }
+
+            x_depot_t & xdepot   = depot(xclass);
+            x_free_t  * xtop_ptr = xdepot.m_xlist.load(std::memory_order_relaxed);
+            do
+            {
+                xtail_ptr->m_xnext = xtop_ptr;
+            } while (!xdepot.m_xlist.compare_exchange_weak(xtop_ptr, xhead_ptr, std::memory_order_release));
+
+            xdepot.m_xcount.fetch_add(xcount, std::memory_order_relaxed);
+        }
+    };
+
+private:
+    /**
+     * @struct x_invoker_t
+     * @brief  存放（退化后的）函数对象与参数列表，调用时直接在 tuple 对象上展开参数（取代 std::bind()）。
+     * @note   参数可能以右值方式传出（参看 nstuple::X_apply_t），只适用于一次性执行的任务对象。
+     */
+    template< typename _Func, typename... _Args >
+    struct x_invoker_t
+    {
+        using _Tuple  = std::tuple< _Args... >;
+        using _Result = typename nstuple::X_apply_t< _Func, _Tuple >::type;
+
+        template< typename _Fy, typename... _Ay >
+        explicit x_invoker_t(_Fy && xfunc, _Ay && ... xargs)
+            : _M_func(std::forward< _Fy >(xfunc))
+            , _M_args(std::forward< _Ay >(xargs)...)
+        {
+
+        }
+
+        inline _Result operator()(void)
+        {
+            return nstuple::X_apply(_M_func, _M_args);
+        }
+
+        _Func  _M_func;   ///< 工作接口（函数对象）
+        _Tuple _M_args;   ///< 工作参数
+    };
+
+    /** 由 submit_task_ex() 等接口的参数推导 x_invoker_t 类型 */
+    template< typename _Func, typename... _Args >
+    using x_invoker_of = x_invoker_t< typename std::decay< _Func >::type, typename std::decay< _Args >::type... >;
+
+    /**
+     * @struct x_task_bind_t
+     * @brief  内部的任务对象实现类。
+     */
+    template< typename _Func >
+    struct x_task_bind_t : public x_task_t, public x_task_alloc_t
+    {
+        // constructor/destructor
+    public:
+        template< typename... _Args >
+        explicit x_task_bind_t(_Args && ... xargs) : _M_func(std::forward< _Args >(xargs)...)
+        {
+
+        }
+
+        // overrides
+    public:
+        /**********************************************************/
+        /**
+         * @brief 任务对象执行流程。
+         */
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            _M_func();
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_task_bind_t);
+        }
+
+        // data members
+    protected:
+        _Func _M_func;   ///< 任务对象执行流程的工作接口（函数对象）
+    };
+
+    /**
+     * @struct x_task_tuple_t
+     * @brief  内部的任务对象实现类（带 x_running_checker_t 回调检测对象）。
+     */
+    template< typename _Func, typename _Tuple, size_t _Xholder_Index >
+    struct x_task_tuple_t : public x_task_t, public x_task_alloc_t
+    {
+        // constructor/destructor
+    public:
+        template< typename _Fy, typename... _Args >
+        explicit x_task_tuple_t(_Fy && xfunc, _Args && ... xargs)
+            : _M_func(std::forward< _Fy >(xfunc))
+            , _M_args(std::forward< _Args >(xargs)...)
+        {
+
+        }
+
+        // overrides
+    public:
+        /**********************************************************/
+        /**
+         * @brief 任务对象执行流程。
+         */
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            call(_M_func, _M_args, xchecker_ptr);
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_task_tuple_t);
+        }
+
+        // internal invoking
+    public:
+        /**********************************************************/
+        /**
+         * @brief 以 xchecker_ptr 替换参数列表中的占位对象后，执行工作接口（x_task_slot_t 共用该流程）。
+         */
+        static void call(_Func & xfunc, _Tuple & xargs, x_running_checker_t * xchecker_ptr)
+        {
+            try { invoke(xfunc, xargs, xchecker_ptr); } catch (...) { }
+        }
+
+    private:
+        /**********************************************************/
+        /**
+         * @brief 执行流程。
+         */
+        static inline void invoke(_Func & xfunc, _Tuple & xargs, x_running_checker_t * xchecker_ptr)
+        {
+            std::get< _Xholder_Index >(xargs) = xchecker_ptr;
+            nstuple::X_apply(xfunc, xargs);
+        }
+
+        // data members
+    private:
+        _Func  _M_func;   ///< 任务对象执行流程的工作接口
+        _Tuple _M_args;   ///< 回调的工作参数
+    };
+
+    /**
+     * @struct x_task_slot_t
+     * @brief  内联存放函数对象的任务对象（固定大小的存储单元，由 x_task_alloc_t 回收复用）。
+     * @note
+     * <pre>
+     *   submit_task_ex() 等泛型接口所创建的函数对象（连同绑定的参数）不超过 ECV_INLINE_SIZE 字节时，
+     *   直接构造在存储单元内；所有函数对象共用本类的虚函数表，执行与析构经由类型擦除的函数指针。
+     *   超出的，仍使用 x_task_bind_t/x_task_tuple_t。
+     *   任务队列是侵入式的，存储单元本身即为队列节点。
+     * </pre>
+     */
+    struct x_task_slot_t final : public x_task_t, public x_task_alloc_t
+    {
+        // common data types
+    public:
+        enum
+        {
+            ECV_INLINE_SIZE = 64,   ///< 内联存储空间的字节数
+        };
+
+        /** 判断函数对象能否内联存放 */
+        template< typename _Payload >
+        struct x_fits_t : public std::integral_constant< bool,
+                    (sizeof(_Payload) <= ECV_INLINE_SIZE) &&
+                    (std::alignment_of< _Payload >::value <= std::alignment_of< std::max_align_t >::value) >
+        {
+
+        };
+
+        /** 构造时指定函数对象类型的标签 */
+        template< typename _Payload >
+        struct x_slot_tag_t
+        {
+
+        };
+
+    private:
+        using x_invoke_t  = void (*)(void *, x_running_checker_t *);
+        using x_destroy_t = void (*)(void *);
+
+        // constructor/destructor
+    public:
+        template< typename _Payload, typename... _Args >
+        x_task_slot_t(x_slot_tag_t< _Payload >, _Args && ... xargs)
+            : m_xinvoke(&invoke_payload< _Payload >)
+            , m_xdestroy(&destroy_payload< _Payload >)
+        {
+            ::new (static_cast< void * >(&m_xstorage)) _Payload(std::forward< _Args >(xargs)...);
+        }
+
+        virtual ~x_task_slot_t(void)
+        {
+            m_xdestroy(static_cast< void * >(&m_xstorage));
+        }
+
+        // overrides
+    public:
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            m_xinvoke(static_cast< void * >(&m_xstorage), xchecker_ptr);
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_task_slot_t);
+        }
+
+        // internal invoking
+    private:
+        template< typename _Payload >
+        static void invoke_payload(void * xstorage, x_running_checker_t * xchecker_ptr)
+        {
+            (*static_cast< _Payload * >(xstorage))(xchecker_ptr);
+        }
+
+        template< typename _Payload >
+        static void destroy_payload(void * xstorage)
+        {
+            static_cast< _Payload * >(xstorage)->~_Payload();
+        }
+
+        // data members
+    private:
+        x_invoke_t   m_xinvoke;    ///< 执行内联函数对象的接口
+        x_destroy_t  m_xdestroy;   ///< 析构内联函数对象的接口
+        typename std::aligned_storage< ECV_INLINE_SIZE, std::alignment_of< std::max_align_t >::value >::type
+                     m_xstorage;   ///< 内联存储空间
+    };
+
+    /**
+     * @struct x_slot_bind_t
+     * @brief  内联存放于 x_task_slot_t 的函数对象（对应 x_task_bind_t）。
+     */
+    template< typename _Func >
+    struct x_slot_bind_t
+    {
+        template< typename... _Args >
+        explicit x_slot_bind_t(_Args && ... xargs) : _M_func(std::forward< _Args >(xargs)...)
+        {
+
+        }
+
+        inline void operator()(x_running_checker_t * xchecker_ptr)
+        {
+            _M_func();
+        }
+
+        _Func _M_func;   ///< 任务对象执行流程的工作接口（函数对象）
+    };
+
+    /**
+     * @struct x_slot_tuple_t
+     * @brief  内联存放于 x_task_slot_t 的函数对象（对应 x_task_tuple_t）。
+     */
+    template< typename _Func, typename _Tuple, size_t _Xholder_Index >
+    struct x_slot_tuple_t
+    {
+        template< typename _Fy, typename... _Args >
+        explicit x_slot_tuple_t(_Fy && xfunc, _Args && ... xargs)
+            : _M_func(std::forward< _Fy >(xfunc))
+            , _M_args(std::forward< _Args >(xargs)...)
+        {
+
+        }
+
+        inline void operator()(x_running_checker_t * xchecker_ptr)
+        {
+            x_task_tuple_t< _Func, _Tuple, _Xholder_Index >::call(_M_func, _M_args, xchecker_ptr);
+        }
+
+        _Func  _M_func;   ///< 任务对象执行流程的工作接口
+        _Tuple _M_args;   ///< 回调的工作参数
+    };
+
+    // common invoking
+private:
+    /** 特化 x_task_maker_t<> 对象后可进行 make_task() 接口的选择。 */
+    template< size_t > struct x_task_maker_t
+    {
+
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 以 bind 参数方式创建任务对象（函数对象与参数直接构造在任务对象内）。
+     */
+    template< typename _Func, typename... _Args >
+    static x_task_ptr_t make_task(const x_task_maker_t< 0 > & xmaker, _Func && xfunc, _Args && ... xargs)
+    {
+        using _Invoker = x_invoker_of< _Func, _Args... >;
+        using _Payload = x_slot_bind_t< _Invoker >;
+
+        return make_slot_task< _Payload, x_task_bind_t< _Invoker > >(
+                    x_task_slot_t::x_fits_t< _Payload >(),
+                    std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 以 tuple 参数方式创建任务对象。
+     */
+    template< typename _Func, typename... _Args >
+    static x_task_ptr_t make_task(const x_task_maker_t< 1 > & xmaker, _Func && xfunc, _Args && ... xargs)
+    {
+        using _Fn    = typename std::decay< _Func >::type;
+        using _Tuple = typename std::tuple< typename std::decay< _Args >::type... >;
+        using _Index = typename nstuple::X_type_index< x_running_checker_t::x_holder_t, 0, typename std::decay< _Args >::type... >;
+
+        constexpr size_t const xholder_index = _Index::value;
+
+        using _Payload = x_slot_tuple_t< _Fn, _Tuple, xholder_index >;
+
+        return make_slot_task< _Payload, x_task_tuple_t< _Fn, _Tuple, xholder_index > >(
+                    x_task_slot_t::x_fits_t< _Payload >(),
+                    std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 函数对象可内联存放时，创建 x_task_slot_t 任务对象。
+     */
+    template< typename _Payload, typename _Task, typename... _Args >
+    static x_task_ptr_t make_slot_task(std::true_type, _Args && ... xargs)
+    {
+        return (new x_task_slot_t(x_task_slot_t::x_slot_tag_t< _Payload >(), std::forward< _Args >(xargs)...));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 函数对象超出内联存储空间时，创建 _Task 类型（x_task_bind_t/x_task_tuple_t）的任务对象。
+     */
+    template< typename _Payload, typename _Task, typename... _Args >
+    static x_task_ptr_t make_slot_task(std::false_type, _Args && ... xargs)
+    {
+        return (new _Task(std::forward< _Args >(xargs)...));
+    }
+
+    // intrusive task queues
+private:
+    /**
+     * @class x_task_list_t
+     * @brief 以 x_task_t::m_xnext_task 链接的侵入式单向链表（FIFO），非线程安全。
+     */
+    class x_task_list_t
+    {
+        // constructor/destructor
+    public:
+        x_task_list_t(void)
+            : m_xhead(nullptr)
+            , m_xtail(nullptr)
+            , m_xsize(0)
+        {
+
+        }
+
+        x_task_list_t(x_task_list_t && xobject) = delete;
+        x_task_list_t & operator=(x_task_list_t && xobject) = delete;
+        x_task_list_t(const x_task_list_t & xobject) = delete;
+        x_task_list_t & operator=(const x_task_list_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        inline bool         empty(void) const { return (nullptr == m_xhead); }
+        inline size_t       size (void) const { return m_xsize; }
+        inline x_task_ptr_t front(void) const { return m_xhead; }
+        inline x_task_ptr_t back (void) const { return m_xtail; }
+
+        /**********************************************************/
+        /**
+         * @brief 返回链表中 xtask_ptr 的后继节点。
+         */
+        static inline x_task_ptr_t next(x_task_ptr_t xtask_ptr)
+        {
+            return xtask_ptr->m_xnext_task.load(std::memory_order_relaxed);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 追加任务对象至链表尾部。
+         */
+        void push_back(x_task_ptr_t xtask_ptr)
+        {
+            xtask_ptr->m_xnext_task.store(nullptr, std::memory_order_relaxed);
+            if (nullptr == m_xtail)
+                m_xhead = xtask_ptr;
+            else
+                m_xtail->m_xnext_task.store(xtask_ptr, std::memory_order_relaxed);
+            m_xtail  = xtask_ptr;
+            m_xsize += 1;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将任务对象插入至链表头部。
+         */
+        void push_front(x_task_ptr_t xtask_ptr)
+        {
+            xtask_ptr->m_xnext_task.store(m_xhead, std::memory_order_relaxed);
+            if (nullptr == m_xtail)
+                m_xtail = xtask_ptr;
+            m_xhead  = xtask_ptr;
+            m_xsize += 1;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 弹出链表头部的任务对象（链表为空时，返回 nullptr）。
+         */
+        x_task_ptr_t pop_front(void)
+        {
+            return erase_after(nullptr);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 移除 xprev_ptr 的后继节点（xprev_ptr 为 nullptr 时，移除头部节点）。
+         */
+        x_task_ptr_t erase_after(x_task_ptr_t xprev_ptr)
+        {
+            x_task_ptr_t xtask_ptr = (nullptr == xprev_ptr) ? m_xhead : next(xprev_ptr);
+            if (nullptr == xtask_ptr)
+            {
+                return nullptr;
+            }
+
+            x_task_ptr_t xnext_ptr = next(xtask_ptr);
+            if (nullptr == xprev_ptr)
+                m_xhead = xnext_ptr;
+            else
+                xprev_ptr->m_xnext_task.store(xnext_ptr, std::memory_order_relaxed);
+            if (m_xtail == xtask_ptr)
+                m_xtail = xprev_ptr;
+
+            xtask_ptr->m_xnext_task.store(nullptr, std::memory_order_relaxed);
+            m_xsize -= 1;
+
+            return xtask_ptr;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将 xlist 的所有节点转移至本链表的尾部。
+         */
+        void splice_back(x_task_list_t & xlist)
+        {
+            if (xlist.empty())
+            {
+                return;
+            }
+
+            if (nullptr == m_xtail)
+                m_xhead = xlist.m_xhead;
+            else
+                m_xtail->m_xnext_task.store(xlist.m_xhead, std::memory_order_relaxed);
+            m_xtail  = xlist.m_xtail;
+            m_xsize += xlist.m_xsize;
+
+            xlist.detach();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 清空链表，但不修改节点间的链接关系（节点已整段转交给其他队列时调用）。
+         */
+        inline void detach(void)
+        {
+            m_xhead = nullptr;
+            m_xtail = nullptr;
+            m_xsize = 0;
+        }
+
+        // data members
+    private:
+        x_task_ptr_t m_xhead;  ///< 头部节点
+        x_task_ptr_t m_xtail;  ///< 尾部节点
+        size_t       m_xsize;  ///< 节点数量
+    };
+
+    /**
+     * @class x_task_mpsc_t
+     * @brief 以 x_task_t::m_xnext_task 链接的侵入式 多生产者/单消费者 队列（Vyukov 的算法）。
+     * @note
+     * <pre>
+     *   push() 只有一次原子交换操作，不加锁、不分配内存，可由任意线程调用；
+     *   pop() 同一时刻只能有一个消费者调用（由调用方加锁保证）。
+     *   实现参看 http://www.1024cores.net/home/lock-free-algorithms/queues/intrusive-mpsc-node-based-queue
+     * </pre>
+     */
+    class x_task_mpsc_t
+    {
+        // common data types
+    private:
+        /**
+         * @struct x_stub_t
+         * @brief  队列内部的哨兵节点。
+         */
+        struct x_stub_t : public x_task_t
+        {
+            virtual void run(x_running_checker_t * xchecker_ptr) override { }
+        };
+
+        // constructor/destructor
+    public:
+        x_task_mpsc_t(void)
+            : m_xhead(&m_xstub)
+            , m_xtail(&m_xstub)
+        {
+
+        }
+
+        x_task_mpsc_t(x_task_mpsc_t && xobject) = delete;
+        x_task_mpsc_t & operator=(x_task_mpsc_t && xobject) = delete;
+        x_task_mpsc_t(const x_task_mpsc_t & xobject) = delete;
+        x_task_mpsc_t & operator=(const x_task_mpsc_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 将 [ xfirst_ptr, ..., xlast_ptr ] 这一段已链接好的任务对象入队（生产者调用）。
+         */
+        void push(x_task_ptr_t xfirst_ptr, x_task_ptr_t xlast_ptr)
+        {
+            xlast_ptr->m_xnext_task.store(nullptr, std::memory_order_relaxed);
+            x_task_ptr_t xprev_ptr = m_xhead.exchange(xlast_ptr, std::memory_order_acq_rel);
+            xprev_ptr->m_xnext_task.store(xfirst_ptr, std::memory_order_release);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 任务对象入队（生产者调用）。
+         */
+        inline void push(x_task_ptr_t xtask_ptr)
+        {
+            push(xtask_ptr, xtask_ptr);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将链表中所有的任务对象入队（生产者调用）。
+         */
+        void push(x_task_list_t & xlist)
+        {
+            if (!xlist.empty())
+            {
+                push(xlist.front(), xlist.back());
+                xlist.detach();
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 任务对象出队（消费者调用）。
+         * 
+         * @return x_task_ptr_t
+         *         - 返回出队的任务对象；
+         *         - 队列为空（或生产者正在入队过程中）时，返回 nullptr。
+         */
+        x_task_ptr_t pop(void)
+        {
+            x_task_ptr_t xtail_ptr = m_xtail;
+            x_task_ptr_t xnext_ptr = xtail_ptr->m_xnext_task.load(std::memory_order_acquire);
+
+            if (xtail_ptr == &m_xstub)
+            {
+                if (nullptr == xnext_ptr)
+                {
+                    return nullptr;
+                }
+
+                m_xtail   = xnext_ptr;
+                xtail_ptr = xnext_ptr;
+                xnext_ptr = xnext_ptr->m_xnext_task.load(std::memory_order_acquire);
+            }
+
+            if (nullptr != xnext_ptr)
+            {
+                m_xtail = xnext_ptr;
+                return xtail_ptr;
+            }
+
+            if (xtail_ptr != m_xhead.load(std::memory_order_acquire))
+            {
+                // 生产者已交换了 m_xhead，但还未完成链接
+                return nullptr;
+            }
+
+            push(&m_xstub);
+
+            xnext_ptr = xtail_ptr->m_xnext_task.load(std::memory_order_acquire);
+            if (nullptr != xnext_ptr)
+            {
+                m_xtail = xnext_ptr;
+                return xtail_ptr;
+            }
+
+            return nullptr;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将队列中所有（当前可见的）任务对象转移至链表尾部（消费者调用）。
+         */
+        void pop_all(x_task_list_t & xlist)
+        {
+            x_task_ptr_t xtask_ptr = nullptr;
+            while (nullptr != (xtask_ptr = pop()))
+            {
+                xlist.push_back(xtask_ptr);
+            }
+        }
+
+        // data members
+    private:
+        std::atomic< x_task_ptr_t > m_xhead;  ///< 生产者端（最后入队的节点）
+        char                        m_xpad[64 - sizeof(std::atomic< x_task_ptr_t >)];
+        x_task_ptr_t                m_xtail;  ///< 消费者端
+        x_stub_t                    m_xstub;  ///< 哨兵节点
+    };
+
+    // ordered execution
+private:
+    /**
+     * @struct x_strand_t
+     * @brief  串行执行序列（strand）：同一键值的任务对象，按提交次序逐个执行。
+     * @note
+     * <pre>
+     *   同一时刻，每个序列只有头部的任务对象进入线程池的任务队列，
+     *   其余的任务对象暂存于 m_lst_tasks 中；头部任务对象执行完成后，
+     *   才放行下一个任务对象。整个过程无需遍历任务队列。
+     * </pre>
+     */
+    struct x_strand_t
+    {
+        x_strand_t(void)
+            : m_xkey(0)
+            , m_xactive(false)
+        {
+
+        }
+
+        size_t        m_xkey;       ///< 键值（哈希值）
+        bool          m_xactive;    ///< 是否已有任务对象放行（在任务队列中或正在执行）
+        x_task_list_t m_lst_tasks;  ///< 等待放行的任务对象
+    };
+
+    /**
+     * @struct x_strand_shard_t
+     * @brief  串行执行序列的分片映射表（按键值的哈希值分片，降低锁竞争）。
+     */
+    struct x_strand_shard_t
+    {
+        x_locker_t                                 m_xlock;  ///< 分片的同步操作锁
+        std::unordered_map< size_t, x_strand_t >   m_xmap;   ///< 键值 -> 串行执行序列
+    };
+
+    enum
+    {
+        ECV_STRAND_SHARDS = 64,  ///< 串行执行序列映射表的分片数量
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 返回键值所在的分片。
+     */
+    inline x_strand_shard_t & strand_shard(size_t xkey)
+    {
+        return m_xstrand_shards[(xkey ^ (xkey >> 17)) % ECV_STRAND_SHARDS];
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 串行执行序列的任务对象执行完成（或被丢弃）后，放行该序列的下一个任务对象。
+     */
+    void release_strand(x_strand_t * xstrand_ptr)
+    {
+        x_strand_shard_t & xshard = strand_shard(xstrand_ptr->m_xkey);
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        {
+            std::lock_guard< x_locker_t > xautolock(xshard.m_xlock);
+
+            xtask_ptr = xstrand_ptr->m_lst_tasks.pop_front();
+            if (nullptr == xtask_ptr)
+            {
+                // 序列已空，移除该序列（xstrand_ptr 随之失效）
+                xshard.m_xmap.erase(xstrand_ptr->m_xkey);
+            }
+        }
+
+        if (nullptr != xtask_ptr)
+        {
+            // 暂存期间已计入 m_xst_task_count，提交后撤销该计数
+            push_task(xtask_ptr);
+            m_xst_task_count.fetch_sub(1);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 删除所有串行执行序列中等待放行的任务对象（cleanup_task() 中使用）。
+     */
+    void cleanup_strands(void)
+    {
+        for (size_t xiter = 0; xiter < ECV_STRAND_SHARDS; ++xiter)
+        {
+            x_task_list_t xlst_tasks;
+
+            {
+                x_strand_shard_t & xshard = m_xstrand_shards[xiter];
+                std::lock_guard< x_locker_t > xautolock(xshard.m_xlock);
+
+                for (std::unordered_map< size_t, x_strand_t >::iterator itmap = xshard.m_xmap.begin();
+                     itmap != xshard.m_xmap.end(); )
+                {
+                    xlst_tasks.splice_back(itmap->second.m_lst_tasks);
+                    if (itmap->second.m_xactive)
+                        ++itmap;
+                    else
+                        itmap = xshard.m_xmap.erase(itmap);
+                }
+            }
+
+            // 暂存于序列中的任务对象只计入任务对象总数量（未计入任务队列的数量）
+            size_t xcount = 0;
+            while (!xlst_tasks.empty())
+            {
+                x_task_ptr_t xtask_ptr = xlst_tasks.pop_front();
+                release_capacity(xtask_ptr);
+                recycle_task(xtask_ptr);
+                xcount += 1;
+            }
+
+            decrease_task_count(xcount);
+        }
+    }
+
+    // priority lanes
+private:
+    /**
+     * @struct x_lane_t
+     * @brief  高优先级（优先级 > 0）任务对象的队列（车道）。
+     * @note
+     * <pre>
+     *   优先级为 0 的任务对象，仍使用原有的任务队列（及环形提交队列、工作窃取的本地队列）；
+     *   优先级 > 0 的任务对象，按优先级分别存放于各个车道中，工作线程总是优先
+     *   从优先级最高的非空车道提取任务对象。与 m_lst_smt_tasks/m_lst_run_tasks 相同，
+     *   提交时无锁入队，持有 m_lock_run_task 时出队。
+     * </pre>
+     */
+    struct x_lane_t
+    {
+        x_lane_t(void)
+            : m_xst_tasks(0)
+            , m_xst_skips(0)
+        {
+
+        }
+
+        x_task_mpsc_t         m_lst_smt_tasks;  ///< 用于提交操作的任务队列
+        x_task_list_t         m_lst_run_tasks;  ///< 待执行的任务队列
+        std::atomic< size_t > m_xst_tasks;      ///< 车道中的任务对象数量
+        size_t                m_xst_skips;      ///< 车道非空时，被更高优先级车道连续抢先的次数
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 按启动参数的优先级数量，准备各个车道（车道数量只增不减，
+     *        已入队的任务对象转移至新的车道）。
+     * @note  仅在 startup() 中（工作线程未运行时）调用。
+     */
+    void create_lanes(size_t xpriorities)
+    {
+        size_t xlanes = (xpriorities > 1) ? (xpriorities - 1) : 0;
+        m_xpriorities = xlanes + 1;
+
+        if (xlanes <= m_xlane_count)
+        {
+            return;
+        }
+
+        std::unique_ptr< x_lane_t[] > xlanes_ptr(new x_lane_t[xlanes]);
+
+        std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
+        for (size_t xiter = 0; xiter < m_xlane_count; ++xiter)
+        {
+            x_lane_t & xlane = m_xlanes[xiter];
+            xlane.m_lst_smt_tasks.pop_all(xlane.m_lst_run_tasks);
+            xlanes_ptr[xiter].m_lst_run_tasks.splice_back(xlane.m_lst_run_tasks);
+            xlanes_ptr[xiter].m_xst_tasks.store(xlane.m_xst_tasks.load());
+        }
+
+        m_xlanes.swap(xlanes_ptr);
+        m_xlane_count = xlanes;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从待执行的任务队列中取出一个可执行的任务对象（检测挂起状态时，跳过挂起的任务对象）。
+     * @note  调用该接口时，需要持有 m_lock_run_task 锁。
+     */
+    x_task_ptr_t pop_run_task(x_task_list_t & xlst_tasks)
+    {
+        if (!m_check_suspened)
+        {
+            return xlst_tasks.pop_front();
+        }
+
+        x_task_ptr_t xtask_ptr = nullptr;
+        uint64_t     xskips    = 0;
+
+        for (x_task_ptr_t xprev_ptr = nullptr, xiter_ptr = xlst_tasks.front();
+             (nullptr != xiter_ptr) && is_enable_get_task();
+             xprev_ptr = xiter_ptr, xiter_ptr = x_task_list_t::next(xiter_ptr))
+        {
+            if (!xiter_ptr->is_suspend())
+            {
+                xtask_ptr = xlst_tasks.erase_after(xprev_ptr);
+                break;
+            }
+
+            xskips += 1;
+        }
+
+        if ((xskips > 0) && (nullptr != this_stats()))
+        {
+            x_worker_stats_t::add(this_stats()->m_xst_skips, xskips);
+        }
+
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从车道中取出任务对象后，更新相关的计数。
+     */
+    inline x_task_ptr_t take_lane_task(x_lane_t & xlane, x_task_ptr_t xtask_ptr)
+    {
+        xlane.m_xst_skips = 0;
+        xlane.m_xst_tasks.fetch_sub(1);
+        m_xst_prio_tasks.fetch_sub(1);
+        m_xst_lst_tasks.fetch_sub(1);
+        xtask_ptr->set_running_flag(true);
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从优先级最高的非空车道中提取任务对象。
+     * @note
+     * <pre>
+     *   返回 nullptr 时，由调用方继续从优先级为 0 的任务队列中提取任务对象。
+     *   老化处理：某个较低优先级的队列（包括优先级 0）非空时，每次被更高优先级的
+     *   车道抢先，都递增其跳过次数；跳过次数达到 m_xaging_quota 后，优先执行
+     *   一次该队列的任务对象，避免其被持续的高优先级负载“饿死”。
+     * </pre>
+     */
+    x_task_ptr_t get_prio_task(void)
+    {
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
+        if (!is_enable_get_task())
+        {
+            return nullptr;
+        }
+
+        for (size_t xiter = 0; xiter < m_xlane_count; ++xiter)
+        {
+            m_xlanes[xiter].m_lst_smt_tasks.pop_all(m_xlanes[xiter].m_lst_run_tasks);
+        }
+
+        bool xlow_pending = (m_xst_lst_tasks.load() > m_xst_prio_tasks.load());
+
+        if (0 != m_xaging_quota)
+        {
+            // 优先级 0 的任务队列已达到老化的阈值，交由调用方提取
+            if (xlow_pending && (m_xst_low_skips >= m_xaging_quota))
+            {
+                m_xst_low_skips = 0;
+                return nullptr;
+            }
+
+            for (size_t xiter = 0; xiter < m_xlane_count; ++xiter)
+            {
+                x_lane_t & xlane = m_xlanes[xiter];
+                if ((xlane.m_xst_skips >= m_xaging_quota) &&
+                    (nullptr != (xtask_ptr = pop_run_task(xlane.m_lst_run_tasks))))
+                {
+                    return take_lane_task(xlane, xtask_ptr);
+                }
+            }
+        }
+
+        for (size_t xiter = m_xlane_count; xiter-- > 0; )
+        {
+            x_lane_t & xlane = m_xlanes[xiter];
+            if (nullptr == (xtask_ptr = pop_run_task(xlane.m_lst_run_tasks)))
+            {
+                continue;
+            }
+
+            // 记录被抢先的较低优先级队列
+            if (xlow_pending)
+            {
+                m_xst_low_skips += 1;
+            }
+
+            for (size_t xlower = 0; xlower < xiter; ++xlower)
+            {
+                if (!m_xlanes[xlower].m_lst_run_tasks.empty())
+                    m_xlanes[xlower].m_xst_skips += 1;
+            }
+
+            return take_lane_task(xlane, xtask_ptr);
+        }
+
+        return nullptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将各个车道中的任务对象转移至链表尾部，并重置车道的计数（cleanup_task() 中使用）。
+     * @note  调用该接口时，需要持有 m_lock_run_task 锁。
+     */
+    void reclaim_lane_tasks(x_task_list_t & xlst_tasks)
+    {
+        for (size_t xiter = 0; xiter < m_xlane_count; ++xiter)
+        {
+            x_lane_t & xlane = m_xlanes[xiter];
+            xlane.m_lst_smt_tasks.pop_all(xlane.m_lst_run_tasks);
+            xlst_tasks.splice_back(xlane.m_lst_run_tasks);
+            xlane.m_xst_tasks.store(0);
+            xlane.m_xst_skips = 0;
+        }
+
+        m_xst_prio_tasks.store(0);
+        m_xst_low_skips = 0;
+    }
+
+    // capacity control
+private:
+    /**********************************************************/
+    /**
+     * @brief 尝试为任务对象预留容量（不阻塞）。
+     * 
+     * @param [in ] xtask_ptr : 任务对象。
+     * @param [in ] xnotify   : 回退预留时，是否通知等待方（持有 m_lock_capacity 锁时，不可通知）。
+     * 
+     * @return bool
+     *         - 预留成功（或未启用容量限制），返回 true；
+     *         - 已达到容量上限，返回 false。
+     */
+    bool try_admit(x_task_ptr_t xtask_ptr, bool xnotify = true)
+    {
+        if (!m_xcap_enabled)
+        {
+            return true;
+        }
+
+        size_t xbytes = xtask_ptr->estimated_size();
+        if (0 == xbytes)
+            xbytes = 1;
+
+        size_t xst_tasks = m_xst_cap_tasks.load();
+        do
+        {
+            if ((0 != m_xcap_tasks) && (xst_tasks >= m_xcap_tasks))
+                return false;
+        } while (!m_xst_cap_tasks.compare_exchange_weak(xst_tasks, xst_tasks + 1));
+
+        if (0 != m_xcap_bytes)
+        {
+            size_t xst_bytes = m_xst_cap_bytes.load();
+            do
+            {
+                // 容量为空时，总可以接纳一个（超过上限的）任务对象，避免其永远无法提交
+                if ((0 != xst_bytes) && (xst_bytes + xbytes > m_xcap_bytes))
+                {
+                    m_xst_cap_tasks.fetch_sub(1);
+                    if (xnotify)
+                        notify_capacity();
+                    return false;
+                }
+            } while (!m_xst_cap_bytes.compare_exchange_weak(xst_bytes, xst_bytes + xbytes));
+        }
+        else
+        {
+            m_xst_cap_bytes.fetch_add(xbytes);
+        }
+
+        xtask_ptr->m_xcap_bytes = xbytes;
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 不论是否达到容量上限，都为任务对象计入容量（定时线程、工作线程等不可阻塞的场景使用）。
+     */
+    void force_admit(x_task_ptr_t xtask_ptr)
+    {
+        if (m_xcap_enabled && (0 == xtask_ptr->m_xcap_bytes))
+        {
+            size_t xbytes = xtask_ptr->estimated_size();
+            if (0 == xbytes)
+                xbytes = 1;
+
+            m_xst_cap_tasks.fetch_add(1);
+            m_xst_cap_bytes.fetch_add(xbytes);
+            xtask_ptr->m_xcap_bytes = xbytes;
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 任务对象执行完成（或被丢弃）后，归还其占用的容量。
+     */
+    inline void release_capacity(x_task_ptr_t xtask_ptr)
+    {
+        size_t xbytes = xtask_ptr->m_xcap_bytes;
+        if (0 != xbytes)
+        {
+            xtask_ptr->m_xcap_bytes = 0;
+            m_xst_cap_bytes.fetch_sub(xbytes);
+            m_xst_cap_tasks.fetch_sub(1);
+            notify_capacity();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若存在因容量已满而等待的提交方线程，则唤醒之（参看 notify_idle_worker() 的说明）。
+     */
+    inline void notify_capacity(void)
+    {
+        if (m_xst_cap_waiters.load() > 0)
+        {
+            {
+                std::lock_guard< x_locker_t > xautolock(m_lock_capacity);
+            }
+
+            // 限制内存估算值时，归还的容量可能只够部分等待方使用，全部唤醒后各自重新检测
+            if (0 != m_xcap_bytes)
+                m_xcap_notifier.notify_all();
+            else
+                m_xcap_notifier.notify_one();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 阻塞等待，直至为任务对象预留到容量（线程池停止运行时，直接计入容量）。
+     */
+    void block_admit(x_task_ptr_t xtask_ptr)
+    {
+        {
+            std::unique_lock< x_locker_t > xunique_locker(m_lock_capacity);
+            m_xst_cap_waiters.fetch_add(1);
+            m_xcap_notifier.wait(xunique_locker,
+                                 [this, xtask_ptr](void) -> bool
+                                 {
+                                     return (try_admit(xtask_ptr, false) || !is_enable_running());
+                                 });
+            m_xst_cap_waiters.fetch_sub(1);
+        }
+
+        force_admit(xtask_ptr);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 丢弃一个最早入队（尚未执行）的任务对象。
+     * 
+     * @return bool
+     *         - 成功丢弃，返回 true；
+     *         - 没有可丢弃的任务对象（都已在执行中），返回 false。
+     */
+    bool drop_oldest_task(void)
+    {
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        // 优先级为 0 的任务对象：环形提交队列 -> 任务队列 -> 各个工作线程的本地队列
+        if (m_xring && m_xring->pop(xtask_ptr))
+        {
+            m_xst_lst_tasks.fetch_sub(1);
+        }
+
+        if (nullptr == xtask_ptr)
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
+            m_lst_smt_tasks.pop_all(m_lst_run_tasks);
+            xtask_ptr = m_lst_run_tasks.pop_front();
+            if (nullptr != xtask_ptr)
+                m_xst_lst_tasks.fetch_sub(1);
+        }
+
+        for (size_t xiter = 0, xcount = m_xworker_count.load(std::memory_order_acquire);
+             (nullptr == xtask_ptr) && (xiter < xcount);
+             ++xiter)
+        {
+            x_worker_t * xworker_ptr = m_xworker_table[xiter].load(std::memory_order_acquire);
+            if (nullptr == xworker_ptr)
+                continue;
+            xtask_ptr = xworker_ptr->m_xdeque.steal();
+            if (nullptr == xtask_ptr)
+                xtask_ptr = pop_inbox_task(xworker_ptr, false);
+            if (nullptr != xtask_ptr)
+                m_xst_lst_tasks.fetch_sub(1);
+        }
+
+        // 再按优先级从低到高，查找各个车道
+        if ((nullptr == xtask_ptr) && (m_xst_prio_tasks.load() > 0))
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
+            for (size_t xiter = 0; (nullptr == xtask_ptr) && (xiter < m_xlane_count); ++xiter)
+            {
+                x_lane_t & xlane = m_xlanes[xiter];
+                xlane.m_lst_smt_tasks.pop_all(xlane.m_lst_run_tasks);
+                xtask_ptr = xlane.m_lst_run_tasks.pop_front();
+                if (nullptr != xtask_ptr)
+                {
+                    xlane.m_xst_tasks.fetch_sub(1);
+                    m_xst_prio_tasks.fetch_sub(1);
+                    m_xst_lst_tasks.fetch_sub(1);
+                }
+            }
+        }
+
+        if (nullptr == xtask_ptr)
+        {
+            return false;
+        }
+
+        x_strand_t * xstrand_ptr = xtask_ptr->m_xstrand_ptr;
+
+        release_capacity(xtask_ptr);
+        recycle_task(xtask_ptr);
+
+        if (nullptr != xstrand_ptr)
+        {
+            release_strand(xstrand_ptr);
+        }
+
+        decrease_task_count();
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 在当前（提交方）线程中直接执行任务对象。
+     */
+    void run_inline(x_task_ptr_t xtask_ptr)
+    {
+        x_running_checker_t * xchecker_ptr = this_checker();
+        if ((nullptr != xchecker_ptr) && (this == xchecker_ptr->m_this_pool_ptr))
+        {
+            xtask_ptr->set_running_flag(true);
+            xtask_ptr->run(xchecker_ptr);
+        }
+        else
+        {
+            x_running_checker_t xht_checker(this, 0);
+            xtask_ptr->set_running_flag(true);
+            xtask_ptr->run(&xht_checker);
+        }
+
+        finish_task(xtask_ptr);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交任务对象前，按容量上限与处理策略为其预留容量。
+     * 
+     * @param [in ] xtask_ptr : 任务对象。
+     * @param [in ] xinline   : 是否允许在当前线程中直接执行（按键值串行执行的任务对象不允许）。
+     * 
+     * @return bool
+     *         - 已预留容量，调用方继续提交该任务对象，返回 true；
+     *         - 任务对象已在当前线程中执行完成，返回 false。
+     */
+    bool admit_task(x_task_ptr_t xtask_ptr, bool xinline = true)
+    {
+        if (try_admit(xtask_ptr))
+        {
+            return true;
+        }
+
+        // 工作线程不可阻塞等待（可能所有工作线程都在等待，造成死锁）
+        x_running_checker_t * xchecker_ptr = this_checker();
+        bool xis_worker = ((nullptr != xchecker_ptr) && (this == xchecker_ptr->m_this_pool_ptr));
+
+        if (xinline &&
+            ((ECV_OVERFLOW_CALLER_RUNS == m_xcap_policy) ||
+             ((ECV_OVERFLOW_BLOCK == m_xcap_policy) && xis_worker)))
+        {
+            run_inline(xtask_ptr);
+            return false;
+        }
+
+        if (ECV_OVERFLOW_DROP_OLDEST == m_xcap_policy)
+        {
+            while (drop_oldest_task())
+            {
+                // 被丢弃的 schedule() 任务对象，此时（未持有内部的锁）才恢复其协程；
+                // 须在预留容量之前：恢复的协程可能在本线程中再次提交并等待容量
+                resume_broken();
+
+                if (try_admit(xtask_ptr))
+                    return true;
+            }
+        }
+
+        if (xis_worker || !is_enable_running())
+            force_admit(xtask_ptr);
+        else
+            block_admit(xtask_ptr);
+
+        return true;
+    }
+
+    // timer wheel
+private:
+    /**
+     * @struct x_timer_link_t
+     * @brief  定时器链表的双向链接节点（时间轮各个槽位的哨兵节点也使用该类型）。
+     */
+    struct x_timer_link_t
+    {
+        x_timer_link_t(void) : m_xprev(nullptr), m_xnext(nullptr) { }
+
+        x_timer_link_t * m_xprev;  ///< 前一节点（不在时间轮中时为 nullptr）
+        x_timer_link_t * m_xnext;  ///< 后一节点
+    };
+
+    /**
+     * @struct x_timer_node_t
+     * @brief  定时器对象的抽象基类（以引用计数管理生命周期）。
+     * @note
+     * <pre>
+     *   时间轮持有一个引用（定时器在时间轮中时）；x_timer_t 句柄持有一个引用；
+     *   到期后提交至线程池的任务对象（x_timer_task_t）也持有一个引用。
+     * </pre>
+     */
+    struct x_timer_node_t : public x_timer_link_t
+    {
+        x_timer_node_t(void)
+            : m_xref(1)
+            , m_xcancelled(false)
+            , m_xwheel_ptr(nullptr)
+            , m_xexpire(0)
+            , m_xperiod(0)
+        {
+
+        }
+
+        virtual ~x_timer_node_t(void) { }
+
+        /**********************************************************/
+        /**
+         * @brief 定时器到期时的回调操作。
+         */
+        virtual void invoke(void) = 0;
+
+        inline void add_ref(void) { m_xref.fetch_add(1, std::memory_order_relaxed); }
+
+        inline void release(void)
+        {
+            if (1 == m_xref.fetch_sub(1, std::memory_order_acq_rel))
+                delete this;
+        }
+
+        std::atomic< size_t >            m_xref;        ///< 引用计数
+        std::atomic< bool >              m_xcancelled;  ///< 是否已取消
+        std::atomic< x_timer_wheel_t * > m_xwheel_ptr;  ///< 所属的时间轮（时间轮销毁后为 nullptr）
+        uint64_t                         m_xexpire;     ///< 到期的时间刻度（毫秒）
+        uint64_t                         m_xperiod;     ///< 周期（毫秒；为 0 时，只执行一次）
+    };
+
+    /**
+     * @struct x_timer_bind_t
+     * @brief  以 bind 对象作为回调操作的定时器对象。
+     */
+    template< typename _Func >
+    struct x_timer_bind_t : public x_timer_node_t
+    {
+        x_timer_bind_t(_Func && xfunc) : _M_func(std::forward< _Func >(xfunc))
+        {
+
+        }
+
+        virtual void invoke(void) override
+        {
+            _M_func();
+        }
+
+        _Func _M_func;   ///< 回调操作的工作接口（函数对象）
+    };
+
+    /**
+     * @struct x_timer_task_t
+     * @brief  定时器到期后，提交至线程池的任务对象。
+     */
+    struct x_timer_task_t : public x_task_t
+    {
+        x_timer_task_t(x_timer_node_t * xnode_ptr) : m_xnode_ptr(xnode_ptr)
+        {
+
+        }
+
+        virtual ~x_timer_task_t(void)
+        {
+            m_xnode_ptr->release();
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            if (!m_xnode_ptr->m_xcancelled.load(std::memory_order_acquire))
+            {
+                try { m_xnode_ptr->invoke(); } catch (...) { }
+            }
+        }
+
+        x_timer_node_t * m_xnode_ptr;  ///< 所执行的定时器对象（持有其一个引用）
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 以 bind 参数方式创建定时器对象。
+     */
+    template< typename _Func, typename... _Args >
+    static x_timer_node_t * make_timer(_Func && xfunc, _Args && ... xargs)
+    {
+        auto xbinder = std::bind(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+        return (new x_timer_bind_t< decltype(xbinder) >(std::forward< decltype(xbinder) >(xbinder)));
+    }
+
+    /**
+     * @class x_timer_wheel_t
+     * @brief 分层时间轮（4 层，每层 256 个槽位，时间刻度为 1 毫秒），由独立的定时线程驱动。
+     * @note
+     * <pre>
+     *   第 0 层的槽位覆盖 256 毫秒，第 1 层约 65.5 秒，第 2 层约 4.66 小时，
+     *   第 3 层约 49.7 天（更远的定时器暂存于第 3 层，逐层下放时再重新计算）。
+     *   增加、取消定时器都是 O(1) 操作；定时器到期时，只生成一个任务对象，
+     *   提交至线程池执行，定时线程自身不执行任何回调操作。
+     * </pre>
+     */
+    class x_timer_wheel_t
+    {
+        // common data types
+    public:
+        enum
+        {
+            ECV_LEVELS    = 4,                      ///< 时间轮的层数
+            ECV_SLOT_BITS = 8,                      ///< 每层槽位数量的位数
+            ECV_SLOTS     = (1 << ECV_SLOT_BITS),   ///< 每层的槽位数量
+            ECV_SLOT_MASK = (ECV_SLOTS - 1),        ///< 槽位索引的掩码
+        };
+
+        using x_clock_t = std::chrono::steady_clock;
+
+        // constructor/destructor
+    public:
+        explicit x_timer_wheel_t(x_threadpool_t * xowner_ptr)
+            : m_xowner_ptr(xowner_ptr)
+            , m_xtm_base(x_clock_t::now())
+            , m_xtick(0)
+            , m_xwake_tick(UINT64_MAX)
+            , m_xcount(0)
+            , m_xstop(false)
+        {
+            for (size_t xlevel = 0; xlevel < ECV_LEVELS; ++xlevel)
+            {
+                for (size_t xslot = 0; xslot < ECV_SLOTS; ++xslot)
+                {
+                    x_timer_link_t & xhead = m_xslots[xlevel][xslot];
+                    xhead.m_xprev = xhead.m_xnext = &xhead;
+                }
+            }
+
+            m_xthread = std::thread([this](void) -> void { thread_run(); });
+        }
+
+        ~x_timer_wheel_t(void)
+        {
+            {
+                std::lock_guard< x_locker_t > xautolock(m_xlock);
+                m_xstop = true;
+            }
+            m_xnotifier.notify_one();
+
+            if (m_xthread.joinable())
+                m_xthread.join();
+
+            // 释放尚未到期的定时器
+            x_timer_link_t xlist;
+            xlist.m_xprev = xlist.m_xnext = &xlist;
+            {
+                std::lock_guard< x_locker_t > xautolock(m_xlock);
+                for (size_t xlevel = 0; xlevel < ECV_LEVELS; ++xlevel)
+                {
+                    for (size_t xslot = 0; xslot < ECV_SLOTS; ++xslot)
+                    {
+                        splice(xlist, m_xslots[xlevel][xslot]);
+                    }
+                }
+
+                for (x_timer_link_t * xiter_ptr = xlist.m_xnext; xiter_ptr != &xlist; xiter_ptr = xiter_ptr->m_xnext)
+                {
+                    static_cast< x_timer_node_t * >(xiter_ptr)->m_xwheel_ptr.store(nullptr);
+                }
+            }
+
+            while (xlist.m_xnext != &xlist)
+            {
+                x_timer_node_t * xnode_ptr = static_cast< x_timer_node_t * >(xlist.m_xnext);
+                unlink(xnode_ptr);
+                xnode_ptr->release();
+            }
+        }
+
+        x_timer_wheel_t(x_timer_wheel_t && xobject) = delete;
+        x_timer_wheel_t & operator=(x_timer_wheel_t && xobject) = delete;
+        x_timer_wheel_t(const x_timer_wheel_t & xobject) = delete;
+        x_timer_wheel_t & operator=(const x_timer_wheel_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 将时间点转换为时间刻度（向上取整，保证定时器不会提前到期）。
+         */
+        inline uint64_t to_tick(x_clock_t::time_point xtime) const
+        {
+            if (xtime <= m_xtm_base)
+                return 0;
+            return static_cast< uint64_t >(
+                std::chrono::duration_cast< std::chrono::milliseconds >(
+                    xtime - m_xtm_base + std::chrono::milliseconds(1) - std::chrono::nanoseconds(1)).count());
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将时长转换为时间刻度数量（向上取整）。
+         */
+        template< typename _Rep, typename _Period >
+        static inline uint64_t to_ticks(const std::chrono::duration< _Rep, _Period > & xduration)
+        {
+            if (xduration <= xduration.zero())
+                return 0;
+            std::chrono::milliseconds xms = std::chrono::duration_cast< std::chrono::milliseconds >(xduration);
+            if (xms < xduration)
+                xms += std::chrono::milliseconds(1);
+            return static_cast< uint64_t >(xms.count());
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 增加定时器（时间轮接管 xnode_ptr 的一个引用）。
+         * 
+         * @param [in ] xnode_ptr : 定时器对象。
+         * @param [in ] xexpire   : 到期的时间刻度。
+         * @param [in ] xperiod   : 周期（时间刻度数量；为 0 时，只执行一次）。
+         */
+        void add(x_timer_node_t * xnode_ptr, uint64_t xexpire, uint64_t xperiod)
+        {
+            bool xnotify = false;
+
+            {
+                std::lock_guard< x_locker_t > xautolock(m_xlock);
+
+                // 时间轮为空时，定时线程不限时等待，m_xtick 停滞于上次处理的时刻；
+                // 此时没有任何定时器可到期，直接跳至当前时刻，避免定时线程持锁逐个补推空闲期间的刻度
+                if (0 == m_xcount)
+                {
+                    uint64_t xnow = now_tick();
+                    if (m_xtick < xnow)
+                        m_xtick = xnow;
+                }
+
+                xnode_ptr->m_xwheel_ptr.store(this);
+                xnode_ptr->m_xexpire = xexpire;
+                xnode_ptr->m_xperiod = xperiod;
+                insert(xnode_ptr);
+                m_xcount += 1;
+
+                // 早于定时线程的下次唤醒时刻，则提前唤醒
+                xnotify = (xexpire < m_xwake_tick);
+                if (xnotify)
+                    m_xwake_tick = xexpire;
+            }
+
+            if (xnotify)
+                m_xnotifier.notify_one();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 取消定时器。
+         * 
+         * @return bool
+         *         - 定时器尚在时间轮中（被移除），返回 true；
+         *         - 定时器已到期（一次性的），或已被取消，返回 false。
+         */
+        bool cancel(x_timer_node_t * xnode_ptr)
+        {
+            bool xremoved = false;
+
+            {
+                std::lock_guard< x_locker_t > xautolock(m_xlock);
+
+                xnode_ptr->m_xcancelled.store(true, std::memory_order_release);
+                if (nullptr != xnode_ptr->m_xprev)
+                {
+                    unlink(xnode_ptr);
+                    m_xcount -= 1;
+                    xremoved = true;
+                }
+            }
+
+            // 释放时间轮持有的引用（在锁外释放，回调对象的析构操作不会持有时间轮的锁）
+            if (xremoved)
+                xnode_ptr->release();
+
+            return xremoved;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 时间轮中的定时器数量。
+         */
+        inline size_t size(void) const
+        {
+            std::lock_guard< x_locker_t > xautolock(m_xlock);
+            return m_xcount;
+        }
+
+        // internal invoking
+    private:
+        /**********************************************************/
+        /**
+         * @brief 当前时刻所对应的时间刻度。
+         */
+        inline uint64_t now_tick(void) const
+        {
+            return static_cast< uint64_t >(
+                std::chrono::duration_cast< std::chrono::milliseconds >(x_clock_t::now() - m_xtm_base).count());
+        }
+
+        static inline void unlink(x_timer_link_t * xlink_ptr)
+        {
+            xlink_ptr->m_xprev->m_xnext = xlink_ptr->m_xnext;
+            xlink_ptr->m_xnext->m_xprev = xlink_ptr->m_xprev;
+            xlink_ptr->m_xprev = nullptr;
+            xlink_ptr->m_xnext = nullptr;
+        }
+
+        static inline void link_back(x_timer_link_t & xhead, x_timer_link_t * xlink_ptr)
+        {
+            xlink_ptr->m_xprev = xhead.m_xprev;
+            xlink_ptr->m_xnext = &xhead;
+            xhead.m_xprev->m_xnext = xlink_ptr;
+            xhead.m_xprev = xlink_ptr;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将 xfrom 链表中的所有节点转移至 xto 链表尾部。
+         */
+        static inline void splice(x_timer_link_t & xto, x_timer_link_t & xfrom)
+        {
+            if (xfrom.m_xnext == &xfrom)
+                return;
+
+            xfrom.m_xnext->m_xprev = xto.m_xprev;
+            xto.m_xprev->m_xnext   = xfrom.m_xnext;
+            xfrom.m_xprev->m_xnext = &xto;
+            xto.m_xprev            = xfrom.m_xprev;
+            xfrom.m_xprev = xfrom.m_xnext = &xfrom;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 按到期时刻，将定时器放入对应层的槽位（需要持有 m_xlock 锁）。
+         */
+        void insert(x_timer_node_t * xnode_ptr)
+        {
+            uint64_t xexpire = (xnode_ptr->m_xexpire > m_xtick) ? xnode_ptr->m_xexpire : m_xtick;
+            uint64_t xdelta  = xexpire - m_xtick;
+
+            size_t xlevel = 0;
+            if (xdelta >= (UINT64_C(1) << (ECV_SLOT_BITS * (ECV_LEVELS - 1))))
+            {
+                // 超出时间轮范围的，暂存于最高层，逐层下放时再重新计算
+                if (xdelta > (UINT64_C(1) << (ECV_SLOT_BITS * ECV_LEVELS)) - 1)
+                    xexpire = m_xtick + (UINT64_C(1) << (ECV_SLOT_BITS * ECV_LEVELS)) - 1;
+                xlevel = ECV_LEVELS - 1;
+            }
+            else
+            {
+                while (xdelta >= (UINT64_C(1) << (ECV_SLOT_BITS * (xlevel + 1))))
+                    xlevel += 1;
+            }
+
+            link_back(m_xslots[xlevel][(xexpire >> (ECV_SLOT_BITS * xlevel)) & ECV_SLOT_MASK], xnode_ptr);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 推进一个时间刻度：必要时将上层槽位逐层下放，再取出到期的定时器（需要持有 m_xlock 锁）。
+         */
+        void advance(x_timer_link_t & xexpired)
+        {
+            size_t xindex = static_cast< size_t >(m_xtick & ECV_SLOT_MASK);
+
+            for (size_t xlevel = 1; (0 == xindex) && (xlevel < ECV_LEVELS); ++xlevel)
+            {
+                xindex = static_cast< size_t >((m_xtick >> (ECV_SLOT_BITS * xlevel)) & ECV_SLOT_MASK);
+
+                x_timer_link_t xlist;
+                xlist.m_xprev = xlist.m_xnext = &xlist;
+                splice(xlist, m_xslots[xlevel][xindex]);
+
+                while (xlist.m_xnext != &xlist)
+                {
+                    x_timer_node_t * xnode_ptr = static_cast< x_timer_node_t * >(xlist.m_xnext);
+                    unlink(xnode_ptr);
+                    insert(xnode_ptr);
+                }
+            }
+
+            splice(xexpired, m_xslots[0][m_xtick & ECV_SLOT_MASK]);
+            m_xtick += 1;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 下次需要唤醒定时线程的时间刻度（需要持有 m_xlock 锁）。
+         */
+        uint64_t next_tick(void) const
+        {
+            if (0 == m_xcount)
+                return UINT64_MAX;
+
+            // 在第 0 层的当前轮次中查找非空的槽位，找不到时，在下一轮次开始时唤醒（以便逐层下放）
+            for (uint64_t xtick = m_xtick; ; ++xtick)
+            {
+                const x_timer_link_t & xhead = m_xslots[0][xtick & ECV_SLOT_MASK];
+                if (xhead.m_xnext != &xhead)
+                    return xtick;
+                if (ECV_SLOT_MASK == (xtick & ECV_SLOT_MASK))
+                    return (xtick + 1);
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 定时线程的执行流程。
+         */
+        void thread_run(void)
+        {
+            std::vector< x_timer_node_t * > xvec_fired;
+
+            std::unique_lock< x_locker_t > xunique_locker(m_xlock);
+            while (!m_xstop)
+            {
+                uint64_t xnow = now_tick();
+
+                while (m_xtick <= xnow)
+                {
+                    x_timer_link_t xexpired;
+                    xexpired.m_xprev = xexpired.m_xnext = &xexpired;
+                    advance(xexpired);
+
+                    while (xexpired.m_xnext != &xexpired)
+                    {
+                        x_timer_node_t * xnode_ptr = static_cast< x_timer_node_t * >(xexpired.m_xnext);
+                        unlink(xnode_ptr);
+
+                        if (0 != xnode_ptr->m_xperiod)
+                        {
+                            // 周期定时器：重新放入时间轮（错过的周期不再补偿），任务对象另持有一个引用
+                            xnode_ptr->m_xexpire += xnode_ptr->m_xperiod;
+                            if (xnode_ptr->m_xexpire <= xnow)
+                                xnode_ptr->m_xexpire = xnow + 1;
+                            insert(xnode_ptr);
+                            xnode_ptr->add_ref();
+                        }
+                        else
+                        {
+                            // 一次性定时器：时间轮持有的引用转交给任务对象
+                            m_xcount -= 1;
+                        }
+
+                        xvec_fired.push_back(xnode_ptr);
+                    }
+                }
+
+                if (!xvec_fired.empty())
+                {
+                    xunique_locker.unlock();
+
+                    for (x_timer_node_t * xnode_ptr : xvec_fired)
+                    {
+                        // 定时线程不可阻塞，到期的任务对象总是计入容量
+                        x_task_ptr_t xtask_ptr = new x_timer_task_t(xnode_ptr);
+                        m_xowner_ptr->force_admit(xtask_ptr);
+                        m_xowner_ptr->push_task(xtask_ptr);
+                    }
+                    xvec_fired.clear();
+
+                    xunique_locker.lock();
+                    continue;
+                }
+
+                m_xwake_tick = next_tick();
+                if (UINT64_MAX == m_xwake_tick)
+                    m_xnotifier.wait(xunique_locker);
+                else
+                    m_xnotifier.wait_until(xunique_locker, m_xtm_base + std::chrono::milliseconds(m_xwake_tick));
+                m_xwake_tick = UINT64_MAX;
+            }
+        }
+
+        // data members
+    private:
+        x_threadpool_t          * m_xowner_ptr;   ///< 所属的线程池对象
+        const x_clock_t::time_point
+                                  m_xtm_base;     ///< 时间刻度 0 所对应的时间点
+        mutable x_locker_t        m_xlock;        ///< 时间轮的同步操作锁
+        std::condition_variable   m_xnotifier;    ///< 定时线程的通知器
+        uint64_t                  m_xtick;        ///< 下一个待处理的时间刻度
+        uint64_t                  m_xwake_tick;   ///< 定时线程的下次唤醒时刻（等待中无到期定时器时为 UINT64_MAX）
+        size_t                    m_xcount;       ///< 时间轮中的定时器数量
+        bool                      m_xstop;        ///< 定时线程的退出标识
+        x_timer_link_t            m_xslots[ECV_LEVELS][ECV_SLOTS];  ///< 各层的槽位（链表哨兵）
+        std::thread               m_xthread;      ///< 定时线程
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 返回时间轮对象（首次调用时创建，并启动定时线程）。
+     */
+    x_timer_wheel_t * timer_wheel(void)
+    {
+        x_timer_wheel_t * xwheel_ptr = m_xtimer_wheel.load(std::memory_order_acquire);
+        if (nullptr == xwheel_ptr)
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_thread);
+
+            xwheel_ptr = m_xtimer_wheel.load(std::memory_order_relaxed);
+            if (nullptr == xwheel_ptr)
+            {
+                xwheel_ptr = new x_timer_wheel_t(this);
+                m_xtimer_wheel.store(xwheel_ptr, std::memory_order_release);
+            }
+        }
+
+        return xwheel_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将定时器加入时间轮，返回其句柄。
+     */
+    x_timer_t add_timer(x_timer_node_t * xnode_ptr, uint64_t xexpire, uint64_t xperiod)
+    {
+        xnode_ptr->add_ref();   // 由句柄持有
+        timer_wheel()->add(xnode_ptr, xexpire, xperiod);
+        return x_timer_t(xnode_ptr);
+    }
+
+    // futures
+private:
+    /**
+     * @struct x_continuation_t
+     * @brief  共享状态完成后才执行的后续操作（侵入式链表节点；参看 x_result_base_t::add_continuation()）。
+     */
+    struct x_continuation_t
+    {
+        x_continuation_t(void) : m_xnext_link(nullptr) { }
+        virtual ~x_continuation_t(void) { }
+
+        /**********************************************************/
+        /**
+         * @brief 所等待的共享状态已完成（由完成方线程调用，不可阻塞）。
+         */
+        virtual void on_ready(void) { }
+
+        x_continuation_t * m_xnext_link;   ///< 链表的后继节点
+    };
+
+    /**
+     * @struct x_result_base_t
+     * @brief  携带执行结果的任务对象的基类（结果的共享状态直接存放于任务对象内，只需一次内存分配）。
+     * @note
+     * <pre>
+     *   任务对象由 线程池 与 x_future_t 对象共同持有（引用计数）；
+     *   状态字 m_xstate 以原子操作更新，等待方以 futex 等待其变化。
+     *   任务对象未执行就被丢弃时（cleanup_task()、丢弃策略等），
+     *   x_future_t 对象获取到 std::future_errc::broken_promise 异常。
+     * </pre>
+     */
+    struct x_result_base_t : public x_task_t, public x_task_alloc_t
+    {
+        enum
+        {
+            ECV_PENDING = 0x0000,   ///< 尚未完成
+            ECV_VALUE   = 0x0001,   ///< 已完成，存放有返回值
+            ECV_ERROR   = 0x0002,   ///< 已完成，存放有异常
+            ECV_WAITING = 0x0100,   ///< 有等待方（完成时需要唤醒）
+        };
+
+        /**
+         * @struct x_deleter_t
+         * @brief  线程池回收任务对象时，只释放其持有的引用。
+         */
+        struct x_deleter_t : public x_task_deleter_t
+        {
+            virtual void delete_task(x_task_ptr_t xtask_ptr) override
+            {
+                x_result_base_t * xresult_ptr = static_cast< x_result_base_t * >(xtask_ptr);
+                if (ECV_PENDING == (xresult_ptr->m_xstate.load(std::memory_order_acquire) & ~ECV_WAITING))
+                {
+                    xresult_ptr->set_exception(std::make_exception_ptr(
+                                        std::future_error(std::future_errc::broken_promise)));
+                }
+                xresult_ptr->release();
+            }
+        };
+
+        x_result_base_t(void) : m_xstate(ECV_PENDING), m_xref(2), m_xcontinuations(nullptr) { }
+
+        virtual const x_task_deleter_t * get_deleter(void) const override
+        {
+            static x_deleter_t _S_deleter;
+            return &_S_deleter;
+        }
+
+        inline void release(void)
+        {
+            if (1 == m_xref.fetch_sub(1, std::memory_order_acq_rel))
+                delete this;
+        }
+
+        inline bool is_ready(void) const
+        {
+            return (ECV_PENDING != (m_xstate.load(std::memory_order_acquire) & ~ECV_WAITING));
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 设置完成状态，并唤醒等待方（若有）。
+         */
+        void set_ready(uint32_t xstate)
+        {
+            if (0 != (m_xstate.exchange(xstate, std::memory_order_acq_rel) & ECV_WAITING))
+            {
+                nsfutex::X_futex_wake_all(m_xstate);
+            }
+
+            // 关闭后续操作链表，并依次执行其中的后续操作
+            x_continuation_t * xlink_ptr = m_xcontinuations.exchange(closed_link(), std::memory_order_acq_rel);
+            while (nullptr != xlink_ptr)
+            {
+                x_continuation_t * xnext_ptr = xlink_ptr->m_xnext_link;
+                xlink_ptr->on_ready();
+                xlink_ptr = xnext_ptr;
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 添加完成后的后续操作（无锁入栈）。
+         * 
+         * @return bool
+         *         - 添加成功，返回 true（完成时由完成方执行）；
+         *         - 已完成，返回 false（由调用方自行执行）。
+         */
+        bool add_continuation(x_continuation_t * xlink_ptr)
+        {
+            x_continuation_t * xhead_ptr = m_xcontinuations.load(std::memory_order_acquire);
+            do
+            {
+                if (closed_link() == xhead_ptr)
+                    return false;
+                xlink_ptr->m_xnext_link = xhead_ptr;
+            } while (!m_xcontinuations.compare_exchange_weak(xhead_ptr, xlink_ptr, std::memory_order_acq_rel));
+
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 后续操作链表已关闭（即已完成）的标识节点。
+         */
+        static inline x_continuation_t * closed_link(void)
+        {
+            static x_continuation_t _S_closed_link;
+            return &_S_closed_link;
+        }
+
+        void set_exception(std::exception_ptr xexception)
+        {
+            m_xexception = xexception;
+            set_ready(ECV_ERROR);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 等待完成，直至超时（xtimeout 为负值时，不限时）。
+         */
+        bool wait(std::chrono::nanoseconds xtimeout = std::chrono::nanoseconds(-1)) const
+        {
+            std::chrono::steady_clock::time_point xtm_end = std::chrono::steady_clock::now() + xtimeout;
+
+            uint32_t xstate = m_xstate.load(std::memory_order_acquire);
+            while (ECV_PENDING == (xstate & ~ECV_WAITING))
+            {
+                // 先标识有等待方，完成方据此决定是否需要唤醒
+                if ((0 == (xstate & ECV_WAITING)) &&
+                    !m_xstate.compare_exchange_weak(xstate, xstate | ECV_WAITING, std::memory_order_acq_rel))
+                {
+                    continue;
+                }
+
+                std::chrono::nanoseconds xremain(-1);
+                if (xtimeout.count() >= 0)
+                {
+                    xremain = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                    xtm_end - std::chrono::steady_clock::now());
+                    if (xremain.count() <= 0)
+                        return false;
+                }
+
+                nsfutex::X_futex_wait(m_xstate, ECV_PENDING | ECV_WAITING, xremain);
+                xstate = m_xstate.load(std::memory_order_acquire);
+            }
+
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 若存放的是异常，则将其抛出。
+         */
+        inline void check_exception(void) const
+        {
+            if (ECV_ERROR == (m_xstate.load(std::memory_order_acquire) & ~ECV_WAITING))
+                std::rethrow_exception(m_xexception);
+        }
+
+        mutable std::atomic< uint32_t >     m_xstate;          ///< 状态字
+        std::atomic< uint32_t >             m_xref;            ///< 引用计数（线程池 与 x_future_t 对象各持有一个）
+        std::exception_ptr                  m_xexception;      ///< 执行过程中抛出的异常
+        std::atomic< x_continuation_t * >   m_xcontinuations;  ///< 完成后的后续操作链表（完成后置为 closed_link()）
+    };
+
+    /**
+     * @struct x_result_state_t
+     * @brief  存放返回值的共享状态。
+     */
+    template< typename _Ty >
+    struct x_result_state_t : public x_result_base_t
+    {
+        virtual ~x_result_state_t(void)
+        {
+            if (ECV_VALUE == (this->m_xstate.load(std::memory_order_acquire) & ~ECV_WAITING))
+                reinterpret_cast< _Ty * >(&m_xvalue)->~_Ty();
+        }
+
+        template< typename _Func >
+        void invoke(_Func & xfunc)
+        {
+            ::new (static_cast< void * >(&m_xvalue)) _Ty(xfunc());
+            this->set_ready(ECV_VALUE);
+        }
+
+        _Ty take_value(void)
+        {
+            this->check_exception();
+            return std::move(*reinterpret_cast< _Ty * >(&m_xvalue));
+        }
+
+        typename std::aligned_storage< sizeof(_Ty), std::alignment_of< _Ty >::value >::type
+            m_xvalue;   ///< 返回值的存储空间
+    };
+
+    /**
+     * @struct x_result_void_t
+     * @brief  无返回值的共享状态。
+     */
+    struct x_result_void_t : public x_result_base_t
+    {
+        template< typename _Func >
+        void invoke(_Func & xfunc)
+        {
+            xfunc();
+            this->set_ready(ECV_VALUE);
+        }
+
+        void take_value(void)
+        {
+            this->check_exception();
+        }
+    };
+
+    /** 按返回值类型选择共享状态的实现类 */
+    template< typename _Ty >
+    using x_result_state_of = typename std::conditional< std::is_void< _Ty >::value,
+                                                         x_result_void_t,
+                                                         x_result_state_t< _Ty > >::type;
+
+    /**
+     * @struct x_result_task_t
+     * @brief  携带执行结果的任务对象的实现类。
+     */
+    template< typename _Ty, typename _Func >
+    struct x_result_task_t : public x_result_state_of< _Ty >
+    {
+        template< typename... _Args >
+        explicit x_result_task_t(_Args && ... xargs) : _M_func(std::forward< _Args >(xargs)...)
+        {
+
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            try
+            {
+                this->invoke(_M_func);
+            }
+            catch (...)
+            {
+                this->set_exception(std::current_exception());
+            }
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_result_task_t);
+        }
+
+        _Func _M_func;   ///< 任务对象执行流程的工作接口（函数对象）
+    };
+
+    /** then() 后续操作的返回值类型（前驱无返回值时，后续操作不带参数） */
+    template< typename _Ty, typename _Func >
+    struct x_then_result
+    {
+        using type = typename std::decay< decltype(std::declval< _Func & >()(std::declval< _Ty >())) >::type;
+    };
+
+    template< typename _Func >
+    struct x_then_result< void, _Func >
+    {
+        using type = typename std::decay< decltype(std::declval< _Func & >()()) >::type;
+    };
+
+    /**
+     * @struct x_then_task_t
+     * @brief  前驱的共享状态完成后，才加入任务队列的后续任务对象（参看 x_future_t::then()）。
+     * @note
+     * <pre>
+     *   后续任务对象持有前驱共享状态的引用，执行时取出前驱的返回值作为参数；
+     *   前驱存放的是异常时，不调用后续操作，而是将该异常传递给后续任务对象。
+     * </pre>
+     */
+    template< typename _Ry, typename _Ty, typename _Func >
+    struct x_then_task_t : public x_result_state_of< _Ry >, public x_continuation_t
+    {
+        template< typename _Fn >
+        x_then_task_t(x_threadpool_t * xpool_ptr, x_result_state_of< _Ty > * xprev_ptr, _Fn && xfunc)
+            : m_xpool_ptr(xpool_ptr)
+            , m_xprev_ptr(xprev_ptr)
+            , _M_func(std::forward< _Fn >(xfunc))
+        {
+
+        }
+
+        virtual ~x_then_task_t(void)
+        {
+            m_xprev_ptr->release();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 前驱已完成：由完成方线程直接加入任务队列（不阻塞，总是计入容量）。
+         */
+        virtual void on_ready(void) override
+        {
+            m_xpool_ptr->force_admit(this);
+            m_xpool_ptr->push_task(this);
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            try
+            {
+                auto xinvoker = [this](void) -> _Ry { return invoke_func(std::is_void< _Ty >()); };
+                this->invoke(xinvoker);
+            }
+            catch (...)
+            {
+                this->set_exception(std::current_exception());
+            }
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_then_task_t);
+        }
+
+        /** 取出前驱的返回值（若为异常，则由 take_value() 抛出）后，调用后续操作 */
+        inline _Ry invoke_func(std::false_type) { return _M_func(m_xprev_ptr->take_value()); }
+        inline _Ry invoke_func(std::true_type ) { m_xprev_ptr->take_value(); return _M_func(); }
+
+        x_threadpool_t           * m_xpool_ptr;   ///< 所属的线程池
+        x_result_state_of< _Ty > * m_xprev_ptr;   ///< 前驱的共享状态
+        _Func                      _M_func;       ///< 后续操作（函数对象）
+    };
+
+public:
+    /**
+     * @struct x_when_any_t
+     * @brief  when_any() 的结果：最先完成的 x_future_t 对象的索引号，以及所有的 x_future_t 对象。
+     */
+    template< typename _Seq >
+    struct x_when_any_t
+    {
+        size_t index;     ///< 最先完成的 x_future_t 对象在 futures 中的索引号（futures 为空时，为 (size_t)-1）
+        _Seq   futures;   ///< 传入的所有 x_future_t 对象
+    };
+
+private:
+    /**
+     * @struct x_when_state_t
+     * @brief  when_all()/when_any() 的共享状态：不提交至线程池，由前驱的完成方线程推进。
+     * @note
+     * <pre>
+     *   每个前驱对应一个后续操作节点（x_when_link_t），各持有一个引用；
+     *   when_all() 在最后一个前驱完成时、when_any() 在第一个前驱完成时，
+     *   将所有的 x_future_t 对象移入执行结果，并唤醒等待方、执行自身的后续操作。
+     * </pre>
+     */
+    template< typename _Seq, bool _Any >
+    struct x_when_state_t
+        : public x_result_state_t< typename std::conditional< _Any, x_when_any_t< _Seq >, _Seq >::type >
+    {
+        using x_value_t = typename std::conditional< _Any, x_when_any_t< _Seq >, _Seq >::type;
+
+        /**
+         * @struct x_when_link_t
+         * @brief  挂接在前驱共享状态上的后续操作节点。
+         */
+        struct x_when_link_t : public x_continuation_t
+        {
+            virtual void on_ready(void) override
+            {
+                m_xowner_ptr->on_link_ready(m_xindex);
+            }
+
+            x_when_state_t * m_xowner_ptr;  ///< 所属的共享状态
+            size_t           m_xindex;      ///< 前驱的索引号
+        };
+
+        x_when_state_t(_Seq && xseq, size_t xcount)
+            : m_xseq(std::move(xseq))
+            , m_xcount(xcount)
+            , m_xfired(false)
+            , m_xlinks(new x_when_link_t[(xcount > 0) ? xcount : 1])
+        {
+            // x_future_t 对象与各个后续操作节点，各持有一个引用
+            this->m_xref.store(static_cast< uint32_t >(1 + xcount));
+
+            for (size_t xiter = 0; xiter < xcount; ++xiter)
+            {
+                m_xlinks[xiter].m_xowner_ptr = this;
+                m_xlinks[xiter].m_xindex     = xiter;
+            }
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            // 不提交至线程池，由前驱的完成方线程推进
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 第 xindex 个前驱已完成。
+         */
+        void on_link_ready(size_t xindex)
+        {
+            if (_Any ? !m_xfired.exchange(true) : (1 == m_xcount.fetch_sub(1)))
+            {
+                complete(xindex);
+            }
+
+            this->release();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 将所有的 x_future_t 对象移入执行结果，并设置完成状态。
+         */
+        void complete(size_t xindex)
+        {
+            try
+            {
+                auto xmaker = [this, xindex](void) -> x_value_t { return make_value(xindex, std::integral_constant< bool, _Any >()); };
+                this->invoke(xmaker);
+            }
+            catch (...)
+            {
+                this->set_exception(std::current_exception());
+            }
+        }
+
+        inline x_value_t make_value(size_t xindex, std::false_type) { return std::move(m_xseq); }
+        inline x_value_t make_value(size_t xindex, std::true_type ) { return x_value_t{ xindex, std::move(m_xseq) }; }
+
+        _Seq                               m_xseq;    ///< 所有的 x_future_t 对象（完成时移入执行结果）
+        std::atomic< size_t >              m_xcount;  ///< 尚未完成的前驱数量（when_all）
+        std::atomic< bool >                m_xfired;  ///< 是否已有前驱完成（when_any）
+        std::unique_ptr< x_when_link_t[] > m_xlinks;  ///< 各个前驱对应的后续操作节点
+    };
+
+public:
+    /**
+     * @class x_future_t
+     * @brief 提交任务对象后，用于获取其执行结果的对象（参看 submit_with_result() 接口）。
+     * @note  只可移动，不可复制；get() 操作后，对象不再有效。
+     */
+    template< typename _Ty >
+    class x_future_t
+    {
+        friend x_threadpool_t;
+
+        // constructor/destructor
+    public:
+        x_future_t(void) : m_xpool_ptr(nullptr), m_xstate_ptr(nullptr) { }
+
+        x_future_t(x_future_t && xobject) : m_xpool_ptr(xobject.m_xpool_ptr), m_xstate_ptr(xobject.m_xstate_ptr)
+        {
+            xobject.m_xstate_ptr = nullptr;
+        }
+
+        x_future_t & operator=(x_future_t && xobject)
+        {
+            std::swap(m_xpool_ptr, xobject.m_xpool_ptr);
+            std::swap(m_xstate_ptr, xobject.m_xstate_ptr);
+            return *this;
+        }
+
+        ~x_future_t(void)
+        {
+            if (nullptr != m_xstate_ptr)
+                m_xstate_ptr->release();
+        }
+
+        x_future_t(const x_future_t & xobject) = delete;
+        x_future_t & operator=(const x_future_t & xobject) = delete;
+
+    private:
+        x_future_t(x_threadpool_t * xpool_ptr, x_result_state_of< _Ty > * xstate_ptr)
+            : m_xpool_ptr(xpool_ptr)
+            , m_xstate_ptr(xstate_ptr)
+        {
+
+        }
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 是否关联了任务对象的执行结果。
+         */
+        inline bool valid(void) const { return (nullptr != m_xstate_ptr); }
+
+        /**********************************************************/
+        /**
+         * @brief 任务对象是否已执行完成（不阻塞）。
+         */
+        inline bool is_ready(void) const
+        {
+            return ((nullptr != m_xstate_ptr) && m_xstate_ptr->is_ready());
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 等待任务对象执行完成。
+         */
+        void wait(void) const
+        {
+            check_state();
+            m_xstate_ptr->wait();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 在指定时长内等待任务对象执行完成。
+         * 
+         * @return bool
+         *         - 已执行完成，返回 true；
+         *         - 超时，返回 false。
+         */
+        template< typename _Rep, typename _Period >
+        bool wait_for(const std::chrono::duration< _Rep, _Period > & xtimeout) const
+        {
+            check_state();
+            std::chrono::nanoseconds xtimeout_ns = std::chrono::duration_cast< std::chrono::nanoseconds >(xtimeout);
+            return m_xstate_ptr->wait((xtimeout_ns.count() < 0) ? std::chrono::nanoseconds(0) : xtimeout_ns);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 等待任务对象执行完成，返回其执行结果（若执行过程中抛出异常，则重新抛出该异常）。
+         */
+        _Ty get(void)
+        {
+            check_state();
+            m_xstate_ptr->wait();
+
+            std::unique_ptr< x_result_state_of< _Ty >, x_releaser_t > xstate_ptr(m_xstate_ptr);
+            m_xstate_ptr = nullptr;
+            return xstate_ptr->take_value();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 注册后续操作：本对象的任务完成后，xfunc 才作为任务对象加入线程池的任务队列。
+         * 
+         * @param [in ] xfunc : 后续操作，以 xfunc(返回值) 方式调用（无返回值时，以 xfunc() 方式调用）。
+         * 
+         * @return x_future_t : 后续操作的 x_future_t 对象（本对象不再有效）。
+         * 
+         * @note
+         * <pre>
+         *   后续任务对象由完成前驱的工作线程直接加入任务队列，没有线程阻塞等待前驱；
+         *   前驱已完成时，由调用方直接加入任务队列。
+         *   前驱执行过程中抛出的异常（或 broken_promise），不调用 xfunc，而是传递给后续的 x_future_t 对象。
+         * </pre>
+         */
+        template< typename _Func >
+        auto then(_Func && xfunc)
+            -> x_future_t< typename x_then_result< _Ty, typename std::decay< _Func >::type >::type >
+        {
+            check_state();
+
+            using _Fn = typename std::decay< _Func >::type;
+            using _Ry = typename x_then_result< _Ty, _Fn >::type;
+
+            x_then_task_t< _Ry, _Ty, _Fn > * xtask_ptr =
+                new x_then_task_t< _Ry, _Ty, _Fn >(m_xpool_ptr, m_xstate_ptr, std::forward< _Func >(xfunc));
+
+            // 前驱共享状态的引用转交给后续任务对象
+            m_xstate_ptr = nullptr;
+
+            x_future_t< _Ry > xfuture(m_xpool_ptr, xtask_ptr);
+            if (!xtask_ptr->m_xprev_ptr->add_continuation(xtask_ptr))
+            {
+                xtask_ptr->on_ready();
+            }
+
+            return xfuture;
+        }
+
+        // internal invoking
+    private:
+        /**
+         * @struct x_releaser_t
+         * @brief  get() 操作返回（或抛出异常）后，释放共享状态的引用。
+         */
+        struct x_releaser_t
+        {
+            void operator()(x_result_state_of< _Ty > * xstate_ptr) const { xstate_ptr->release(); }
+        };
+
+        inline void check_state(void) const
+        {
+            if (nullptr == m_xstate_ptr)
+                throw std::future_error(std::future_errc::no_state);
+        }
+
+        // data members
+    private:
+        x_threadpool_t           * m_xpool_ptr;    ///< 所属的线程池（后续操作提交至该线程池）
+        x_result_state_of< _Ty > * m_xstate_ptr;   ///< 共享状态（即任务对象）
+    };
+
+    /**
+     * @class x_task_graph_t
+     * @brief 静态的任务依赖图：构建一次后，可多次提交执行（参看 submit_graph() 接口）。
+     * @note
+     * <pre>
+     *   每个节点为一个无参的操作；add_edge(a, b) 表示节点 a 执行完成后，节点 b 才可执行。
+     *   执行时，完成某个节点最后一个前驱的工作线程，直接将该节点加入任务队列，没有线程阻塞等待。
+     *   执行期间不可修改依赖图，且依赖图对象须在执行完成前保持有效。
+     * </pre>
+     */
+    class x_task_graph_t
+    {
+        friend x_threadpool_t;
+
+        // common data types
+    private:
+        /**
+         * @struct x_node_t
+         * @brief  依赖图的节点。
+         */
+        struct x_node_t
+        {
+            std::function< void(void) > m_xfunc;        ///< 节点的操作
+            std::vector< size_t >       m_xsuccessors;  ///< 后继节点的索引号
+            size_t                      m_xindegree;    ///< 前驱节点的数量
+        };
+
+        // constructor/destructor
+    public:
+        x_task_graph_t(void) { }
+
+        x_task_graph_t(const x_task_graph_t & xobject) = delete;
+        x_task_graph_t & operator=(const x_task_graph_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 添加节点，返回其索引号。
+         */
+        template< typename _Func >
+        size_t add_node(_Func && xfunc)
+        {
+            m_xvec_nodes.push_back(x_node_t{ std::function< void(void) >(std::forward< _Func >(xfunc)),
+                                             std::vector< size_t >(),
+                                             0 });
+            return (m_xvec_nodes.size() - 1);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 添加依赖：节点 xfrom 执行完成后，节点 xto 才可执行。
+         * 
+         * @return bool
+         *         - 成功，返回 true；
+         *         - 索引号无效（或 xfrom == xto），返回 false。
+         */
+        bool add_edge(size_t xfrom, size_t xto)
+        {
+            if ((xfrom >= m_xvec_nodes.size()) || (xto >= m_xvec_nodes.size()) || (xfrom == xto))
+            {
+                return false;
+            }
+
+            m_xvec_nodes[xfrom].m_xsuccessors.push_back(xto);
+            m_xvec_nodes[xto].m_xindegree += 1;
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 节点数量。
+         */
+        inline size_t size(void) const { return m_xvec_nodes.size(); }
+
+        // internal invoking
+    private:
+        /**********************************************************/
+        /**
+         * @brief 空的依赖图（依赖图存在环时，以其代替，不执行任何节点）。
+         */
+        static inline const x_task_graph_t & empty_graph(void)
+        {
+            static const x_task_graph_t _S_empty_graph;
+            return _S_empty_graph;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 检测依赖图中是否存在环（拓扑排序）。
+         */
+        bool is_acyclic(void) const
+        {
+            std::vector< size_t > xvec_indegree(m_xvec_nodes.size());
+            std::vector< size_t > xvec_ready;
+            for (size_t xiter = 0; xiter < m_xvec_nodes.size(); ++xiter)
+            {
+                xvec_indegree[xiter] = m_xvec_nodes[xiter].m_xindegree;
+                if (0 == xvec_indegree[xiter])
+                    xvec_ready.push_back(xiter);
+            }
+
+            size_t xvisited = 0;
+            while (!xvec_ready.empty())
+            {
+                size_t xindex = xvec_ready.back();
+                xvec_ready.pop_back();
+                xvisited += 1;
+
+                for (size_t xnext : m_xvec_nodes[xindex].m_xsuccessors)
+                {
+                    if (0 == --xvec_indegree[xnext])
+                        xvec_ready.push_back(xnext);
+                }
+            }
+
+            return (xvisited == m_xvec_nodes.size());
+        }
+
+        // data members
+    private:
+        std::vector< x_node_t > m_xvec_nodes;   ///< 所有的节点
+    };
+
+private:
+    /**
+     * @struct x_graph_run_t
+     * @brief  依赖图的一次执行（同时作为其 x_future_t< void > 对象的共享状态）。
+     * @note
+     * <pre>
+     *   各个节点的任务对象存放于本对象内，各持有一个引用（回收时释放）；
+     *   节点执行完成后，递减各个后继节点的前驱计数，降为 0 的后继节点直接加入任务队列。
+     *   节点抛出异常后，后续节点不再执行其操作（但仍按依赖关系推进），
+     *   执行结果存放第一个异常；节点的任务对象未执行就被回收时，存放 broken_promise 异常。
+     * </pre>
+     */
+    struct x_graph_run_t : public x_result_void_t
+    {
+        /**
+         * @struct x_node_task_t
+         * @brief  节点的任务对象。
+         */
+        struct x_node_task_t : public x_task_t
+        {
+            /**
+             * @struct x_deleter_t
+             * @brief  回收节点的任务对象时，释放其持有的引用。
+             */
+            struct x_deleter_t : public x_task_deleter_t
+            {
+                virtual void delete_task(x_task_ptr_t xtask_ptr) override
+                {
+                    x_node_task_t * xnode_ptr = static_cast< x_node_task_t * >(xtask_ptr);
+                    xnode_ptr->m_xowner_ptr->recycle_node(xnode_ptr->m_xindex, xnode_ptr->m_xexecuted);
+                }
+            };
+
+            x_node_task_t(void) : m_xowner_ptr(nullptr), m_xindex(0), m_xexecuted(false) { }
+
+            virtual const x_task_deleter_t * get_deleter(void) const override
+            {
+                static x_deleter_t _S_deleter;
+                return &_S_deleter;
+            }
+
+            virtual void run(x_running_checker_t * xchecker_ptr) override
+            {
+                m_xexecuted = true;
+                m_xowner_ptr->run_node(m_xindex);
+            }
+
+            x_graph_run_t * m_xowner_ptr;  ///< 所属的执行对象
+            size_t          m_xindex;      ///< 节点的索引号
+            bool            m_xexecuted;   ///< 是否已执行
+        };
+
+        x_graph_run_t(x_threadpool_t * xpool_ptr, const x_task_graph_t & xgraph)
+            : m_xpool_ptr(xpool_ptr)
+            , m_xgraph(xgraph)
+            , m_xtasks(new x_node_task_t[xgraph.size() + 1])
+            , m_xpending(new std::atomic< size_t >[xgraph.size() + 1])
+            , m_xremain(xgraph.size())
+            , m_xcancelled(false)
+        {
+            // x_future_t 对象与各个节点的任务对象，各持有一个引用
+            this->m_xref.store(static_cast< uint32_t >(1 + xgraph.size()));
+
+            for (size_t xiter = 0; xiter < xgraph.size(); ++xiter)
+            {
+                m_xtasks[xiter].m_xowner_ptr = this;
+                m_xtasks[xiter].m_xindex     = xiter;
+                m_xpending[xiter].store(xgraph.m_xvec_nodes[xiter].m_xindegree);
+            }
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            // 不提交至线程池，由各个节点的任务对象推进
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 提交所有的起始节点（没有前驱的节点）。
+         */
+        void start(void)
+        {
+            for (size_t xiter = 0; xiter < m_xgraph.size(); ++xiter)
+            {
+                if (0 == m_xgraph.m_xvec_nodes[xiter].m_xindegree)
+                {
+                    m_xpool_ptr->submit_task(&m_xtasks[xiter]);
+                }
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 执行节点的操作，并推进其后继节点。
+         */
+        void run_node(size_t xindex)
+        {
+            if (!m_xcancelled.load(std::memory_order_relaxed))
+            {
+                try
+                {
+                    m_xgraph.m_xvec_nodes[xindex].m_xfunc();
+                }
+                catch (...)
+                {
+                    set_error(std::current_exception());
+                }
+            }
+
+            finish_node(xindex, true);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 回收节点的任务对象（未执行时，视为被丢弃）。
+         */
+        void recycle_node(size_t xindex, bool xexecuted)
+        {
+            if (!xexecuted)
+            {
+                set_error(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+                finish_node(xindex, false);
+            }
+
+            this->release();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 节点已结束：递减后继节点的前驱计数，降为 0 的后继节点加入任务队列
+         *        （xenqueue 为 false 时，不再执行，直接结束该后继节点）。
+         */
+        void finish_node(size_t xindex, bool xenqueue)
+        {
+            for (size_t xnext : m_xgraph.m_xvec_nodes[xindex].m_xsuccessors)
+            {
+                if (1 != m_xpending[xnext].fetch_sub(1))
+                {
+                    continue;
+                }
+
+                if (xenqueue)
+                {
+                    // 由完成最后一个前驱的线程直接加入任务队列（不阻塞，总是计入容量）
+                    m_xpool_ptr->force_admit(&m_xtasks[xnext]);
+                    m_xpool_ptr->push_task(&m_xtasks[xnext]);
+                }
+                else
+                {
+                    finish_node(xnext, false);
+                    this->release();
+                }
+            }
+
+            if (1 == m_xremain.fetch_sub(1))
+            {
+                if (m_xerror)
+                    this->set_exception(m_xerror);
+                else
+                    this->set_ready(ECV_VALUE);
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 记录第一个异常，后续节点不再执行其操作。
+         */
+        void set_error(std::exception_ptr xexception)
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_error);
+            if (!m_xerror)
+            {
+                m_xerror = xexception;
+            }
+            m_xcancelled.store(true);
+        }
+
+        x_threadpool_t                            * m_xpool_ptr;   ///< 所属的线程池
+        const x_task_graph_t                      & m_xgraph;      ///< 依赖图
+        std::unique_ptr< x_node_task_t[] >          m_xtasks;      ///< 各个节点的任务对象
+        std::unique_ptr< std::atomic< size_t >[] >  m_xpending;    ///< 各个节点尚未完成的前驱数量
+        std::atomic< size_t >                       m_xremain;     ///< 尚未结束的节点数量
+        std::atomic< bool >                         m_xcancelled;  ///< 是否已有节点抛出异常
+        x_locker_t                                  m_lock_error;  ///< m_xerror 的同步操作锁
+        std::exception_ptr                          m_xerror;      ///< 第一个异常
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 构建 when_all()/when_any() 的共享状态，并在各个前驱上挂接后续操作节点。
+     * 
+     * @param [in ] xseq      : 所有的 x_future_t 对象。
+     * @param [in ] xprev_ptr : 各个 x_future_t 对象的共享状态（无效的 x_future_t 对象为 nullptr，视为已完成）。
+     * @param [in ] xcount    : x_future_t 对象的数量。
+     */
+    template< bool _Any, typename _Seq >
+    x_future_t< typename x_when_state_t< _Seq, _Any >::x_value_t >
+        make_when(_Seq && xseq, x_result_base_t ** xprev_ptr, size_t xcount)
+    {
+        x_when_state_t< _Seq, _Any > * xstate_ptr = new x_when_state_t< _Seq, _Any >(std::move(xseq), xcount);
+        x_future_t< typename x_when_state_t< _Seq, _Any >::x_value_t > xfuture(this, xstate_ptr);
+
+        if (0 == xcount)
+        {
+            xstate_ptr->complete(static_cast< size_t >(-1));
+            return xfuture;
+        }
+
+        for (size_t xiter = 0; xiter < xcount; ++xiter)
+        {
+            x_continuation_t * xlink_ptr = &xstate_ptr->m_xlinks[xiter];
+            if ((nullptr == xprev_ptr[xiter]) || !xprev_ptr[xiter]->add_continuation(xlink_ptr))
+            {
+                xlink_ptr->on_ready();
+            }
+        }
+
+        return xfuture;
+    }
+
+    // task group
+public:
+    /**
+     * @class x_task_group_t
+     * @brief 任务组：经由其提交的任务对象全部执行完成后，wait() 操作才返回。
+     * @note
+     * <pre>
+     *   任务对象执行完成（或被丢弃、被清理）并回收后，递减任务组的计数；
+     *   计数降为 0 时，若有等待方，则直接唤醒（futex），无需轮询 task_count()。
+     *   析构时会等待所有任务对象执行完成；不可在组内任务对象中等待所属的任务组。
+     * </pre>
+     */
+    class x_task_group_t
+    {
+        friend x_threadpool_t;
+
+        // common data types
+    private:
+        enum
+        {
+            ECV_WAITING    = 0x80000000,  ///< 存在等待方的标识位
+            ECV_COUNT_MASK = 0x7FFFFFFF,  ///< 任务对象计数的掩码
+        };
+
+        // constructor/destructor
+    public:
+        explicit x_task_group_t(x_threadpool_t & xpool)
+            : m_xpool(xpool)
+            , m_xstate(0)
+        {
+
+        }
+
+        ~x_task_group_t(void)
+        {
+            wait();
+        }
+
+        x_task_group_t(const x_task_group_t & xobject) = delete;
+        x_task_group_t(x_task_group_t && xobject) = delete;
+        x_task_group_t & operator=(const x_task_group_t & xobject) = delete;
+        x_task_group_t & operator=(x_task_group_t && xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 提交隶属于该任务组的任务对象（参看 x_threadpool_t::submit_task() 接口）。
+         */
+        void submit_task(x_task_ptr_t xtask_ptr)
+        {
+            if (nullptr == xtask_ptr)
+                return;
+
+            // 先递增计数，任务对象可能在提交操作返回前即已执行完成
+            xtask_ptr->m_xgroup_ptr = this;
+            m_xstate.fetch_add(1);
+            m_xpool.submit_task(xtask_ptr);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 提交隶属于该任务组的任务对象（泛型接口，参数同 x_threadpool_t::submit_task_ex()）。
+         */
+        template< typename _Func, typename... _Args >
+        void submit_task_ex(_Func && xfunc, _Args && ... xargs)
+        {
+            constexpr size_t const xchecker_count =
+                    nstuple::X_type_count<
+                        x_running_checker_t::x_holder_t,
+                        typename std::decay< _Args >::type... >::value;
+
+            static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
+
+            submit_task(make_task(
+                            x_task_maker_t< xchecker_count >(),
+                            std::forward< _Func >(xfunc),
+                            std::forward< _Args >(xargs)...));
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 尚未执行完成的任务对象数量。
+         */
+        inline size_t size(void) const
+        {
+            return (m_xstate.load() & ECV_COUNT_MASK);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 等待组内所有任务对象执行完成。
+         */
+        void wait(void)
+        {
+            wait_until(nullptr);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 在指定时长内，等待组内所有任务对象执行完成。
+         * 
+         * @return bool
+         *         - 已全部执行完成，返回 true；
+         *         - 超时，返回 false。
+         */
+        template< typename _Rep, typename _Period >
+        bool wait_for(const std::chrono::duration< _Rep, _Period > & xtimeout)
+        {
+            std::chrono::steady_clock::time_point xtm_end =
+                std::chrono::steady_clock::now() + std::chrono::duration_cast< std::chrono::nanoseconds >(xtimeout);
+            return wait_until(&xtm_end);
+        }
+
+        // internal invoking
+    private:
+        /**********************************************************/
+        /**
+         * @brief 等待计数降为 0，直至超时（xtm_end 为 nullptr 时，不限时）。
+         */
+        bool wait_until(const std::chrono::steady_clock::time_point * xtm_end)
+        {
+            uint32_t xstate = m_xstate.load();
+            while (0 != (xstate & ECV_COUNT_MASK))
+            {
+                std::chrono::nanoseconds xremain(-1);
+                if (nullptr != xtm_end)
+                {
+                    xremain = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                    *xtm_end - std::chrono::steady_clock::now());
+                    if (xremain.count() <= 0)
+                        return false;
+                }
+
+                // 设置等待标识后，再以 futex 等待状态字的变化
+                if ((0 == (xstate & ECV_WAITING)) &&
+                    !m_xstate.compare_exchange_weak(xstate, xstate | ECV_WAITING))
+                {
+                    continue;
+                }
+
+                nsfutex::X_futex_wait(m_xstate, xstate | ECV_WAITING, xremain);
+                xstate = m_xstate.load();
+            }
+
+            // 清除残留的等待标识（计数为 0 时，不会再有完成方读取该标识）
+            if (0 != xstate)
+            {
+                m_xstate.compare_exchange_strong(xstate, 0);
+            }
+
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 组内的任务对象回收后，递减计数（由 x_threadpool_t::recycle_task() 调用）。
+         */
+        inline void finish_task(void)
+        {
+            uint32_t xstate = m_xstate.fetch_sub(1);
+            if ((ECV_WAITING | 1) == xstate)
+            {
+                nsfutex::X_futex_wake_all(m_xstate);
+            }
+        }
+
+        // data members
+    private:
+        x_threadpool_t           & m_xpool;    ///< 所属的线程池
+        std::atomic< uint32_t >    m_xstate;   ///< 状态字：ECV_WAITING 标识位 | 未完成的任务对象计数
+    };
+
+#if XTHREADPOOL_HAS_COROUTINE
+
+    // coroutines
+private:
+    /**
+     * @class x_frame_alloc_t
+     * @brief 协程帧的回收分配器（按 64 字节分级缓存已释放的内存块）。
+     * @note
+     * <pre>
+     *   分配器由 线程池 与 尚未释放的协程帧 共同持有（引用计数），
+     *   因此协程帧可晚于线程池对象释放；超出分级上限的内存块直接使用全局堆。
+     * </pre>
+     */
+    class x_frame_alloc_t
+    {
+        // common data types
+    private:
+        enum
+        {
+            ECV_GRANULE = 64,   ///< 分级的粒度（字节数）
+            ECV_CLASSES = 16,   ///< 分级数量（超出 ECV_GRANULE * ECV_CLASSES 字节的内存块不缓存）
+            ECV_CACHED  = 256,  ///< 每一级最多缓存的内存块数量
+        };
+
+        /**
+         * @struct x_header_t
+         * @brief  内存块的头部（所属的分配器为 nullptr 时，表示直接使用全局堆）。
+         */
+        struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) x_header_t
+        {
+            x_frame_alloc_t * m_xowner;   ///< 所属的分配器
+            size_t            m_xclass;   ///< 分级索引号
+        };
+
+        /**
+         * @struct x_free_t
+         * @brief  缓存的内存块（复用内存块的起始位置作为链接指针）。
+         */
+        struct x_free_t
+        {
+            x_free_t * m_xnext;
+        };
+
+        /**
+         * @struct x_class_t
+         * @brief  某一分级的缓存链表。
+         */
+        struct x_class_t
+        {
+            x_locker_t  m_xlock;    ///< 同步操作锁
+            x_free_t  * m_xfree;    ///< 缓存的内存块链表
+            size_t      m_xcount;   ///< 缓存的内存块数量
+        };
+
+        // constructor/destructor
+    public:
+        x_frame_alloc_t(void) : m_xref(1)
+        {
+            for (size_t xiter = 0; xiter < ECV_CLASSES; ++xiter)
+            {
+                m_xclasses[xiter].m_xfree  = nullptr;
+                m_xclasses[xiter].m_xcount = 0;
+            }
+        }
+
+        ~x_frame_alloc_t(void)
+        {
+            for (size_t xiter = 0; xiter < ECV_CLASSES; ++xiter)
+            {
+                x_free_t * xfree_ptr = m_xclasses[xiter].m_xfree;
+                while (nullptr != xfree_ptr)
+                {
+                    x_free_t * xnext_ptr = xfree_ptr->m_xnext;
+                    ::operator delete(static_cast< void * >(xfree_ptr));
+                    xfree_ptr = xnext_ptr;
+                }
+            }
+        }
+
+        x_frame_alloc_t(x_frame_alloc_t && xobject) = delete;
+        x_frame_alloc_t & operator=(x_frame_alloc_t && xobject) = delete;
+        x_frame_alloc_t(const x_frame_alloc_t & xobject) = delete;
+        x_frame_alloc_t & operator=(const x_frame_alloc_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 分配内存块（xalloc_ptr 为 nullptr 时，直接使用全局堆）。
+         */
+        static void * allocate(x_frame_alloc_t * xalloc_ptr, size_t xsize)
+        {
+            size_t xbytes = xsize + sizeof(x_header_t);
+            size_t xclass = (xbytes + ECV_GRANULE - 1) / ECV_GRANULE;
+            void * xblock = nullptr;
+
+            if ((nullptr == xalloc_ptr) || (xclass > ECV_CLASSES))
+            {
+                xalloc_ptr = nullptr;
+                xclass     = 0;
+                xblock     = ::operator new(xbytes);
+            }
+            else
+            {
+                x_class_t & xcls = xalloc_ptr->m_xclasses[xclass - 1];
+                {
+                    std::lock_guard< x_locker_t > xautolock(xcls.m_xlock);
+                    x_free_t * xfree_ptr = xcls.m_xfree;
+                    if (nullptr != xfree_ptr)
+                    {
+                        xcls.m_xfree   = xfree_ptr->m_xnext;
+                        xcls.m_xcount -= 1;
+                        xblock = xfree_ptr;
+                    }
+                }
+
+                if (nullptr == xblock)
+                    xblock = ::operator new(xclass * ECV_GRANULE);
+                xalloc_ptr->m_xref.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            x_header_t * xheader_ptr = ::new (xblock) x_header_t;
+            xheader_ptr->m_xowner = xalloc_ptr;
+            xheader_ptr->m_xclass = xclass;
+            return static_cast< void * >(xheader_ptr + 1);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 释放 allocate() 分配的内存块（缓存至所属分配器的对应分级，或归还全局堆）。
+         */
+        static void deallocate(void * xptr)
+        {
+            if (nullptr == xptr)
+                return;
+
+            x_header_t      * xheader_ptr = static_cast< x_header_t * >(xptr) - 1;
+            x_frame_alloc_t * xalloc_ptr  = xheader_ptr->m_xowner;
+            if (nullptr == xalloc_ptr)
+            {
+                ::operator delete(static_cast< void * >(xheader_ptr));
+                return;
+            }
+
+            x_class_t & xcls = xalloc_ptr->m_xclasses[xheader_ptr->m_xclass - 1];
+            x_free_t  * xfree_ptr = ::new (static_cast< void * >(xheader_ptr)) x_free_t;
+            {
+                std::lock_guard< x_locker_t > xautolock(xcls.m_xlock);
+                if (xcls.m_xcount < ECV_CACHED)
+                {
+                    xfree_ptr->m_xnext = xcls.m_xfree;
+                    xcls.m_xfree       = xfree_ptr;
+                    xcls.m_xcount     += 1;
+                    xfree_ptr          = nullptr;
+                }
+            }
+
+            if (nullptr != xfree_ptr)
+                ::operator delete(static_cast< void * >(xfree_ptr));
+            xalloc_ptr->release();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 释放引用（线程池析构时，以及每个内存块释放时）。
+         */
+        inline void release(void)
+        {
+            if (1 == m_xref.fetch_sub(1, std::memory_order_acq_rel))
+                delete this;
+        }
+
+        // data members
+    private:
+        std::atomic< size_t > m_xref;                    ///< 引用计数
+        x_class_t             m_xclasses[ECV_CLASSES];   ///< 各个分级的缓存链表
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 线程池所属的协程帧分配器（首次使用时创建）。
+     */
+    x_frame_alloc_t * frame_alloc(void) const
+    {
+        x_frame_alloc_t * xalloc_ptr = m_xframe_alloc.load(std::memory_order_acquire);
+        if (nullptr == xalloc_ptr)
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_thread);
+
+            xalloc_ptr = m_xframe_alloc.load(std::memory_order_relaxed);
+            if (nullptr == xalloc_ptr)
+            {
+                xalloc_ptr = new x_frame_alloc_t();
+                m_xframe_alloc.store(xalloc_ptr, std::memory_order_release);
+            }
+        }
+
+        return xalloc_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 当前线程丢弃的 x_resume_task_t 所对应、尚待恢复的协程（参看 resume_broken()）。
+     */
+    static inline std::vector< std::coroutine_handle<> > & this_broken_resumes(void)
+    {
+        static thread_local std::vector< std::coroutine_handle<> > _S_broken_resumes;
+        return _S_broken_resumes;
+    }
+
+    /**
+     * @struct x_resume_task_t
+     * @brief  在工作线程中恢复协程执行的任务对象（参看 schedule() 接口）。
+     * @note
+     * <pre>
+     *   未执行就被丢弃时（cleanup_task()、丢弃策略等），析构函数只记下该协程，
+     *   由丢弃方在释放线程池内部的锁之后恢复（参看 resume_broken()），
+     *   并由 co_await 表达式抛出 std::future_errc::broken_promise 异常。
+     *   协程可能执行任意代码（包括再次提交任务对象），因此不可在析构函数中（持锁时）直接恢复。
+     * </pre>
+     */
+    struct x_resume_task_t : public x_task_t, public x_task_alloc_t
+    {
+        x_resume_task_t(std::coroutine_handle<> xhandle, bool * xbroken_ptr)
+            : m_xhandle(xhandle)
+            , m_xbroken_ptr(xbroken_ptr)
+        {
+
+        }
+
+        virtual ~x_resume_task_t(void)
+        {
+            if (m_xhandle)
+            {
+                *m_xbroken_ptr = true;
+                this_broken_resumes().push_back(m_xhandle);
+            }
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            std::coroutine_handle<> xhandle = m_xhandle;
+            m_xhandle = nullptr;
+            xhandle.resume();
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_resume_task_t);
+        }
+
+        std::coroutine_handle<>   m_xhandle;      ///< 待恢复的协程（执行后置空）
+        bool                    * m_xbroken_ptr;  ///< 被丢弃时置位的标识（位于等待方的协程帧内）
+    };
+
+    /**
+     * @struct x_co_promise_base_t
+     * @brief  x_co_task_t 的 promise_type 基类：协程帧由线程池的 x_frame_alloc_t 分配。
+     * @note
+     * <pre>
+     *   协程的首个参数为 x_threadpool_t & 时，使用该线程池的分配器；
+     *   否则，若在某个线程池的工作线程中创建，则使用该线程池的分配器；其余情况使用全局堆。
+     * </pre>
+     */
+    struct x_co_promise_base_t
+    {
+        /**
+         * @struct x_final_awaiter_t
+         * @brief  协程结束时，以对称转移（symmetric transfer）恢复等待方，不经由任务队列。
+         */
+        struct x_final_awaiter_t
+        {
+            bool await_ready(void) const noexcept { return false; }
+
+            template< typename _Promise >
+            std::coroutine_handle<> await_suspend(std::coroutine_handle< _Promise > xhandle) noexcept
+            {
+                x_co_promise_base_t & xpromise = xhandle.promise();
+                if (xpromise.m_xcontinuation)
+                    return xpromise.m_xcontinuation;
+
+                // 由 submit_coroutine() 启动的协程：通知其共享状态（会销毁本协程帧）
+                if (nullptr != xpromise.m_xnotify_ptr)
+                    xpromise.m_xnotify_ptr->on_ready();
+                return std::noop_coroutine();
+            }
+
+            void await_resume(void) const noexcept { }
+        };
+
+        x_co_promise_base_t(void) : m_xnotify_ptr(nullptr) { }
+
+        std::suspend_always initial_suspend(void) const noexcept { return std::suspend_always(); }
+        x_final_awaiter_t   final_suspend  (void) const noexcept { return x_final_awaiter_t(); }
+
+        void unhandled_exception(void) { m_xexception = std::current_exception(); }
+
+        inline void check_exception(void) const
+        {
+            if (m_xexception)
+                std::rethrow_exception(m_xexception);
+        }
+
+        static void * operator new(size_t xsize)
+        {
+            x_running_checker_t * xchecker_ptr = this_checker();
+            return x_frame_alloc_t::allocate(
+                        (nullptr != xchecker_ptr) ? xchecker_ptr->m_this_pool_ptr->frame_alloc() : nullptr,
+                        xsize);
+        }
+
+        template< typename... _Args >
+        static void * operator new(size_t xsize, x_threadpool_t & xpool, _Args & ... xargs)
+        {
+            return x_frame_alloc_t::allocate(xpool.frame_alloc(), xsize);
+        }
+
+        static void operator delete(void * xptr)
+        {
+            x_frame_alloc_t::deallocate(xptr);
+        }
+
+        std::coroutine_handle<>   m_xcontinuation;  ///< 等待本协程的协程（co_await 时设置）
+        x_continuation_t        * m_xnotify_ptr;    ///< 结束时的通知对象（submit_coroutine() 时设置）
+        std::exception_ptr        m_xexception;     ///< 协程体抛出的异常
+    };
+
+    template< typename _Ty >
+    struct x_co_promise_t : public x_co_promise_base_t
+    {
+        x_co_promise_t(void) : m_xvalid(false) { }
+
+        ~x_co_promise_t(void)
+        {
+            if (m_xvalid)
+                reinterpret_cast< _Ty * >(&m_xvalue)->~_Ty();
+        }
+
+        template< typename _Vy >
+        void return_value(_Vy && xvalue)
+        {
+            ::new (static_cast< void * >(&m_xvalue)) _Ty(std::forward< _Vy >(xvalue));
+            m_xvalid = true;
+        }
+
+        _Ty take_value(void)
+        {
+            this->check_exception();
+            return std::move(*reinterpret_cast< _Ty * >(&m_xvalue));
+        }
+
+        typename std::aligned_storage< sizeof(_Ty), std::alignment_of< _Ty >::value >::type
+                m_xvalue;   ///< 返回值的存储空间
+        bool    m_xvalid;   ///< 是否已存放返回值
+    };
+
+    template< typename _Ty >
+    struct x_co_promise_void_t : public x_co_promise_base_t
+    {
+        void return_void(void) { }
+
+        void take_value(void)
+        {
+            this->check_exception();
+        }
+    };
+
+public:
+    /**
+     * @class x_schedule_awaiter_t
+     * @brief schedule() 返回的可等待对象：挂起当前协程，并在线程池的工作线程中恢复执行。
+     */
+    class x_schedule_awaiter_t
+    {
+        friend x_threadpool_t;
+
+        // constructor/destructor
+    private:
+        explicit x_schedule_awaiter_t(x_threadpool_t * xpool_ptr) : m_xpool_ptr(xpool_ptr), m_xbroken(false) { }
+
+        // awaitable interfaces
+    public:
+        bool await_ready(void) const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> xhandle)
+        {
+            m_xpool_ptr->submit_task(new x_resume_task_t(xhandle, &m_xbroken));
+        }
+
+        void await_resume(void) const
+        {
+            if (m_xbroken)
+                throw std::future_error(std::future_errc::broken_promise);
+        }
+
+        // data members
+    private:
+        x_threadpool_t * m_xpool_ptr;   ///< 所属的线程池
+        bool             m_xbroken;     ///< 恢复执行的任务对象是否被丢弃
+    };
+
+    /**
+     * @class x_co_task_t
+     * @brief 惰性启动的协程类型（C++20）。
+     * @note
+     * <pre>
+     *   1. 创建后并不执行，直至被 co_await（在等待方所在的线程中启动），
+     *      或者经由 submit_coroutine() 提交至线程池；
+     *   2. 协程结束时，以对称转移直接恢复等待方，不再经由任务队列提交；
+     *   3. 协程帧由线程池所属的分配器分配（参看 x_co_promise_base_t）；
+     *   4. 对象只可移动，析构时销毁尚未启动（或已结束）的协程帧。
+     * </pre>
+     */
+    template< typename _Ty = void >
+    class x_co_task_t
+    {
+        friend x_threadpool_t;
+
+        // common data types
+    public:
+        struct promise_type : public std::conditional< std::is_void< _Ty >::value,
+                                                       x_co_promise_void_t< _Ty >,
+                                                       x_co_promise_t< _Ty > >::type
+        {
+            x_co_task_t get_return_object(void)
+            {
+                return x_co_task_t(std::coroutine_handle< promise_type >::from_promise(*this));
+            }
+        };
+
+        using x_handle_t = std::coroutine_handle< promise_type >;
+
+        /**
+         * @struct x_awaiter_t
+         * @brief  co_await 的等待对象：以对称转移启动协程，结束后取出其返回值（或抛出其异常）。
+         */
+        struct x_awaiter_t
+        {
+            bool await_ready(void) const noexcept
+            {
+                return (!m_xhandle || m_xhandle.done());
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> xcontinuation) noexcept
+            {
+                m_xhandle.promise().m_xcontinuation = xcontinuation;
+                return m_xhandle;
+            }
+
+            _Ty await_resume(void)
+            {
+                if (!m_xhandle)
+                    throw std::future_error(std::future_errc::no_state);
+                return m_xhandle.promise().take_value();
+            }
+
+            x_handle_t m_xhandle;
+        };
+
+        // constructor/destructor
+    public:
+        x_co_task_t(void) noexcept : m_xhandle(nullptr) { }
+
+        x_co_task_t(x_co_task_t && xobject) noexcept : m_xhandle(xobject.m_xhandle)
+        {
+            xobject.m_xhandle = nullptr;
+        }
+
+        x_co_task_t & operator=(x_co_task_t && xobject) noexcept
+        {
+            if (this != &xobject)
+            {
+                if (m_xhandle)
+                    m_xhandle.destroy();
+                m_xhandle = xobject.m_xhandle;
+                xobject.m_xhandle = nullptr;
+            }
+
+            return *this;
+        }
+
+        ~x_co_task_t(void)
+        {
+            if (m_xhandle)
+                m_xhandle.destroy();
+        }
+
+        x_co_task_t(const x_co_task_t & xobject) = delete;
+        x_co_task_t & operator=(const x_co_task_t & xobject) = delete;
+
+    private:
+        explicit x_co_task_t(x_handle_t xhandle) noexcept : m_xhandle(xhandle) { }
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 是否关联有协程。
+         */
+        inline bool valid(void) const noexcept
+        {
+            return static_cast< bool >(m_xhandle);
+        }
+
+        x_awaiter_t operator co_await(void) const noexcept
+        {
+            return x_awaiter_t{ m_xhandle };
+        }
+
+        // data members
+    private:
+        x_handle_t m_xhandle;   ///< 所关联的协程
+    };
+
+private:
+    /**
+     * @struct x_co_spawn_task_t
+     * @brief  启动协程的任务对象（参看 submit_coroutine()），同时也是返回的 x_future_t 的共享状态。
+     * @note
+     * <pre>
+     *   run() 只是启动协程，协程结束时（可能在另一个线程中）才设置完成状态；
+     *   因此除了 线程池 与 x_future_t 对象，协程也持有一个引用。
+     *   未启动就被丢弃时，销毁协程帧，x_future_t 对象获取到 broken_promise 异常。
+     * </pre>
+     */
+    template< typename _Ty >
+    struct x_co_spawn_task_t : public x_result_state_of< _Ty >, public x_continuation_t
+    {
+        using x_handle_t = typename x_co_task_t< _Ty >::x_handle_t;
+
+        /**
+         * @struct x_deleter_t
+         * @brief  回收任务对象时，若协程尚未启动，则将其销毁（并释放协程所持有的引用），
+         *         x_future_t 对象获取到 broken_promise 异常。
+         */
+        struct x_deleter_t : public x_result_base_t::x_deleter_t
+        {
+            virtual void delete_task(x_task_ptr_t xtask_ptr) override
+            {
+                x_co_spawn_task_t * xspawn_ptr = static_cast< x_co_spawn_task_t * >(xtask_ptr);
+                if (xspawn_ptr->m_xstarted)
+                {
+                    // 已启动：由协程结束时设置完成状态，此处只释放线程池持有的引用
+                    xspawn_ptr->release();
+                    return;
+                }
+
+                xspawn_ptr->m_xhandle.destroy();
+                xspawn_ptr->release();
+                x_result_base_t::x_deleter_t::delete_task(xtask_ptr);
+            }
+        };
+
+        explicit x_co_spawn_task_t(x_handle_t xhandle) : m_xhandle(xhandle), m_xstarted(false)
+        {
+            this->m_xref.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        virtual const x_task_deleter_t * get_deleter(void) const override
+        {
+            static x_deleter_t _S_deleter;
+            return &_S_deleter;
+        }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            m_xstarted = true;
+            m_xhandle.promise().m_xnotify_ptr = this;
+            m_xhandle.resume();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 协程已结束（在其最终挂起点调用）：取出结果，销毁协程帧。
+         */
+        virtual void on_ready(void) override
+        {
+            x_handle_t xhandle = m_xhandle;
+            try
+            {
+                auto xinvoker = [xhandle](void) -> _Ty { return xhandle.promise().take_value(); };
+                this->invoke(xinvoker);
+            }
+            catch (...)
+            {
+                this->set_exception(std::current_exception());
+            }
+
+            xhandle.destroy();
+            this->release();
+        }
+
+        virtual size_t estimated_size(void) const override
+        {
+            return sizeof(x_co_spawn_task_t);
+        }
+
+        x_handle_t m_xhandle;    ///< 所启动的协程
+        bool       m_xstarted;   ///< 协程是否已启动（只由执行/回收任务对象的线程访问）
+    };
+
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+
+    // work stealing
+private:
+    /**
+     * @class x_ws_deque_t
+     * @brief 工作窃取模式下，工作线程本地的 Chase-Lev 双端队列（固定容量）。
+     * @note
+     * <pre>
+     *   只有所属的工作线程可调用 push() 与 pop() 接口（在队列的底端操作），
+     *   其他线程只能调用 steal() 接口（在队列的顶端操作）。
+     *   实现参看论文 “Correct and Efficient Work-Stealing for Weak Memory Models”。
+     * </pre>
+     */
+    class x_ws_deque_t
+    {
+        // common data types
+    public:
+        enum
+        {
+            ECV_CAPACITY = 4096,               ///< 队列容量（必须为 2 的幂）
+            ECV_MASK     = ECV_CAPACITY - 1,   ///< 索引掩码
+        };
+
+        // constructor/destructor
+    public:
+        x_ws_deque_t(void)
+            : m_xtop(0)
+            , m_xbottom(0)
+        {
+            for (size_t xiter = 0; xiter < ECV_CAPACITY; ++xiter)
+                m_xbuffer[xiter].store(nullptr, std::memory_order_relaxed);
+        }
+
+        x_ws_deque_t(x_ws_deque_t && xobject) = delete;
+        x_ws_deque_t & operator=(x_ws_deque_t && xobject) = delete;
+        x_ws_deque_t(const x_ws_deque_t & xobject) = delete;
+        x_ws_deque_t & operator=(const x_ws_deque_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 将任务对象压入队列底端（仅所属工作线程调用）。
+         *
+         * @return bool
+         *         - 成功，返回 true；
+         *         - 队列已满，返回 false。
+         */
+        bool push(x_task_ptr_t xtask_ptr)
+        {
+            int64_t xbottom = m_xbottom.load(std::memory_order_relaxed);
+            int64_t xtop    = m_xtop.load(std::memory_order_acquire);
+            if ((xbottom - xtop) >= (int64_t)ECV_CAPACITY)
+            {
+                return false;
+            }
+
+            m_xbuffer[xbottom & ECV_MASK].store(xtask_ptr, std::memory_order_relaxed);
+            m_xbottom.store(xbottom + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 从队列底端弹出任务对象（仅所属工作线程调用）。
+         */
+        x_task_ptr_t pop(void)
+        {
+            int64_t xbottom = m_xbottom.load(std::memory_order_relaxed) - 1;
+            m_xbottom.store(xbottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t xtop = m_xtop.load(std::memory_order_relaxed);
+
+            if (xtop > xbottom)
+            {
+                // 队列为空
+                m_xbottom.store(xbottom + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+
+            x_task_ptr_t xtask_ptr = m_xbuffer[xbottom & ECV_MASK].load(std::memory_order_relaxed);
+            if (xtop == xbottom)
+            {
+                // 仅剩最后一个对象，与窃取线程进行竞争
+                if (!m_xtop.compare_exchange_strong(xtop, xtop + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed))
+                {
+                    xtask_ptr = nullptr;
+                }
+
+                m_xbottom.store(xbottom + 1, std::memory_order_relaxed);
+            }
+
+            return xtask_ptr;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 从队列顶端窃取任务对象（任意线程均可调用）。
+         */
+        x_task_ptr_t steal(void)
+        {
+            int64_t xtop = m_xtop.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t xbottom = m_xbottom.load(std::memory_order_acquire);
+
+            if (xtop >= xbottom)
+            {
+                return nullptr;
+            }
+
+            x_task_ptr_t xtask_ptr = m_xbuffer[xtop & ECV_MASK].load(std::memory_order_relaxed);
+            if (!m_xtop.compare_exchange_strong(xtop, xtop + 1,
+                                                std::memory_order_seq_cst,
+                                                std::memory_order_relaxed))
+            {
+                // 与其他线程竞争失败
+                return nullptr;
+            }
+
+            return xtask_ptr;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 判断队列是否为空（仅为估算值）。
+         */
+        inline bool empty(void) const
+        {
+            return (m_xbottom.load(std::memory_order_relaxed) <=
+                    m_xtop.load(std::memory_order_relaxed));
+        }
+
+        // data members
+    private:
+        std::atomic< int64_t >      m_xtop;      ///< 队列顶端（窃取端）
+        char                        m_xpad1[64 - sizeof(std::atomic< int64_t >)];
+        std::atomic< int64_t >      m_xbottom;   ///< 队列底端（所属线程操作端）
+        char                        m_xpad2[64 - sizeof(std::atomic< int64_t >)];
+        std::atomic< x_task_ptr_t > m_xbuffer[ECV_CAPACITY];  ///< 环形缓存
+    };
+
+    /**
+     * @class x_mpmc_ring_t
+     * @brief 有界的、无锁的 多生产者/多消费者 环形队列（Vyukov 的序列号算法）。
+     * @note
+     * <pre>
+     *   每个单元格带有一个序列号，生产者/消费者通过比较序列号与各自的位置计数，
+     *   判断单元格是否可写/可读，只在竞争位置计数时使用 CAS 操作，全程不加锁、不分配内存。
+     *   实现参看 http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+     * </pre>
+     */
+    template< typename _Ty >
+    class x_mpmc_ring_t
+    {
+        // common data types
+    private:
+        struct x_cell_t
+        {
+            std::atomic< size_t > m_xsequence;  ///< 单元格的序列号
+            _Ty                   m_xvalue;     ///< 单元格存储的对象
+        };
+
+        // constructor/destructor
+    public:
+        explicit x_mpmc_ring_t(size_t xcapacity)
+        {
+            size_t xsize = 2;
+            while (xsize < xcapacity)
+                xsize <<= 1;
+
+            m_xcells.reset(new x_cell_t[xsize]);
+            m_xmask = xsize - 1;
+
+            for (size_t xiter = 0; xiter < xsize; ++xiter)
+                m_xcells[xiter].m_xsequence.store(xiter, std::memory_order_relaxed);
+
+            m_xenqueue_pos.store(0, std::memory_order_relaxed);
+            m_xdequeue_pos.store(0, std::memory_order_release);
+        }
+
+        x_mpmc_ring_t(x_mpmc_ring_t && xobject) = delete;
+        x_mpmc_ring_t & operator=(x_mpmc_ring_t && xobject) = delete;
+        x_mpmc_ring_t(const x_mpmc_ring_t & xobject) = delete;
+        x_mpmc_ring_t & operator=(const x_mpmc_ring_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 队列容量。
+         */
+        inline size_t capacity(void) const { return (m_xmask + 1); }
+
+        /**********************************************************/
+        /**
+         * @brief 对象入队。
+         *
+         * @return bool
+         *         - 成功，返回 true；
+         *         - 队列已满，返回 false。
+         */
+        bool push(_Ty && xvalue)
+        {
+            x_cell_t * xcell_ptr = nullptr;
+            size_t     xpos      = m_xenqueue_pos.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                xcell_ptr = &m_xcells[xpos & m_xmask];
+
+                size_t   xseq  = xcell_ptr->m_xsequence.load(std::memory_order_acquire);
+                intptr_t xdiff = (intptr_t)xseq - (intptr_t)xpos;
+                if (0 == xdiff)
+                {
+                    if (m_xenqueue_pos.compare_exchange_weak(xpos, xpos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (xdiff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    xpos = m_xenqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+
+            xcell_ptr->m_xvalue = std::move(xvalue);
+            xcell_ptr->m_xsequence.store(xpos + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 对象出队。
+         *
+         * @return bool
+         *         - 成功，返回 true；
+         *         - 队列为空，返回 false。
+         */
+        bool pop(_Ty & xvalue)
+        {
+            x_cell_t * xcell_ptr = nullptr;
+            size_t     xpos      = m_xdequeue_pos.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                xcell_ptr = &m_xcells[xpos & m_xmask];
+
+                size_t   xseq  = xcell_ptr->m_xsequence.load(std::memory_order_acquire);
+                intptr_t xdiff = (intptr_t)xseq - (intptr_t)(xpos + 1);
+                if (0 == xdiff)
+                {
+                    if (m_xdequeue_pos.compare_exchange_weak(xpos, xpos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (xdiff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    xpos = m_xdequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+
+            xvalue = std::move(xcell_ptr->m_xvalue);
+            xcell_ptr->m_xsequence.store(xpos + m_xmask + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        // data members
+    private:
+        std::unique_ptr< x_cell_t[] > m_xcells;        ///< 单元格数组
+        size_t                        m_xmask;         ///< 索引掩码（容量 - 1）
+        char                          m_xpad1[64 - sizeof(size_t)];
+        std::atomic< size_t >         m_xenqueue_pos;  ///< 生产者的位置计数
+        char                          m_xpad2[64 - sizeof(std::atomic< size_t >)];
+        std::atomic< size_t >         m_xdequeue_pos;  ///< 消费者的位置计数
+        char                          m_xpad3[64 - sizeof(std::atomic< size_t >)];
+    };
+
+    using x_task_ring_t = x_mpmc_ring_t< x_task_ptr_t >;
+
+#if XTHREADPOOL_ENABLE_TRACE
+    /**********************************************************/
+    /**
+     * @brief 当前线程正在执行的任务对象以 set_trace_label() 设置的追踪标签。
+     */
+    static inline const char *& this_trace_label(void)
+    {
+        static thread_local const char * _S_this_trace_label = nullptr;
+        return _S_this_trace_label;
+    }
+
+    /**
+     * @struct x_trace_record_t
+     * @brief  任务对象的追踪记录（各个时间点均取自 steady_ns()）。
+     */
+    struct x_trace_record_t
+    {
+        uint64_t     m_xtm_submit;   ///< 入队的时间点（为 0 时未记录：入队时未启用追踪）
+        uint64_t     m_xtm_dequeue;  ///< 被工作线程提取的时间点
+        uint64_t     m_xtm_start;    ///< 开始执行的时间点
+        uint64_t     m_xtm_end;      ///< 执行结束的时间点
+        const char * m_xlabel;       ///< 任务标签（可能为 nullptr）
+    };
+
+    /**
+     * @class x_trace_ring_t
+     * @brief 工作线程的追踪记录环形缓存（只由所属工作线程写入，写满后覆盖最早的记录）。
+     * @note
+     * <pre>
+     *   每个单元格带有一个序列号（seqlock）：写入前置为奇数，写完后置为偶数；
+     *   读取方不加锁，前后两次读到的序列号不一致（或不是期望值）时，说明该记录正被覆盖，跳过即可。
+     * </pre>
+     */
+    class x_trace_ring_t
+    {
+        // common data types
+    private:
+        struct x_cell_t
+        {
+            std::atomic< uint64_t >     m_xsequence;  ///< 单元格的序列号（写入第 n 条记录时为 2n + 1，写完后为 2n + 2）
+            std::atomic< uint64_t >     m_xtimes[4];  ///< 入队、提取、开始执行、执行结束的时间点
+            std::atomic< const char * > m_xlabel;     ///< 任务标签
+        };
+
+        // constructor/destructor
+    public:
+        x_trace_ring_t(size_t xcapacity)
+        {
+            size_t xsize = 2;
+            while (xsize < xcapacity)
+                xsize <<= 1;
+
+            m_xcells.reset(new x_cell_t[xsize]);
+            m_xmask = xsize - 1;
+
+            for (size_t xiter = 0; xiter < xsize; ++xiter)
+                m_xcells[xiter].m_xsequence.store(0, std::memory_order_relaxed);
+
+            m_xwrite_pos.store(0, std::memory_order_release);
+        }
+
+        x_trace_ring_t(const x_trace_ring_t & xobject) = delete;
+        x_trace_ring_t & operator=(const x_trace_ring_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 缓存容量（2 的幂）。
+         */
+        inline size_t capacity(void) const { return (m_xmask + 1); }
+
+        /**********************************************************/
+        /**
+         * @brief 写入一条记录（只由所属工作线程调用）。
+         */
+        void push(const x_trace_record_t & xrecord)
+        {
+            uint64_t   xpos  = m_xwrite_pos.load(std::memory_order_relaxed);
+            x_cell_t & xcell = m_xcells[xpos & m_xmask];
+
+            xcell.m_xsequence.store(2 * xpos + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            xcell.m_xtimes[0].store(xrecord.m_xtm_submit , std::memory_order_relaxed);
+            xcell.m_xtimes[1].store(xrecord.m_xtm_dequeue, std::memory_order_relaxed);
+            xcell.m_xtimes[2].store(xrecord.m_xtm_start  , std::memory_order_relaxed);
+            xcell.m_xtimes[3].store(xrecord.m_xtm_end    , std::memory_order_relaxed);
+            xcell.m_xlabel.store(xrecord.m_xlabel, std::memory_order_relaxed);
+
+            xcell.m_xsequence.store(2 * xpos + 2, std::memory_order_release);
+            m_xwrite_pos.store(xpos + 1, std::memory_order_release);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 按写入次序，遍历缓存中完整的记录：xfunc(uint64_t xpos, const x_trace_record_t & xrecord)。
+         */
+        template< typename _Func >
+        void visit(_Func && xfunc) const
+        {
+            uint64_t xend   = m_xwrite_pos.load(std::memory_order_acquire);
+            uint64_t xbegin = (xend > capacity()) ? (xend - capacity()) : 0;
+
+            for (uint64_t xpos = xbegin; xpos < xend; ++xpos)
+            {
+                const x_cell_t & xcell = m_xcells[xpos & m_xmask];
+                if ((2 * xpos + 2) != xcell.m_xsequence.load(std::memory_order_acquire))
+                    continue;
+
+                x_trace_record_t xrecord;
+                xrecord.m_xtm_submit  = xcell.m_xtimes[0].load(std::memory_order_relaxed);
+                xrecord.m_xtm_dequeue = xcell.m_xtimes[1].load(std::memory_order_relaxed);
+                xrecord.m_xtm_start   = xcell.m_xtimes[2].load(std::memory_order_relaxed);
+                xrecord.m_xtm_end     = xcell.m_xtimes[3].load(std::memory_order_relaxed);
+                xrecord.m_xlabel      = xcell.m_xlabel.load(std::memory_order_relaxed);
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if ((2 * xpos + 2) != xcell.m_xsequence.load(std::memory_order_relaxed))
+                    continue;
+
+                xfunc(xpos, xrecord);
+            }
+        }
+
+        // data members
+    private:
+        std::unique_ptr< x_cell_t[] > m_xcells;      ///< 单元格数组
+        size_t                        m_xmask;       ///< 索引掩码（容量 - 1）
+        std::atomic< uint64_t >       m_xwrite_pos;  ///< 已写入的记录数量
+    };
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+    /**
+     * @struct x_worker_t
+     * @brief  工作线程的私有数据（工作窃取模式下使用）。
+     */
+    struct x_worker_t
+    {
+        x_worker_t(const x_threadpool_t * xowner_ptr, size_t xthread_index)
+            : m_xowner_ptr(xowner_ptr)
+            , m_xthread_index(xthread_index)
+            , m_xst_inbox(0)
+            , m_xrand_seed((uint32_t)(2654435761U * (xthread_index + 1)))
+        {
+
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 产生（选取窃取对象的）伪随机数（xorshift32）。
+         */
+        inline uint32_t next_random(void)
+        {
+            uint32_t xseed = m_xrand_seed;
+            xseed ^= xseed << 13;
+            xseed ^= xseed >> 17;
+            xseed ^= xseed << 5;
+            m_xrand_seed = xseed;
+            return xseed;
+        }
+
+        const x_threadpool_t *    m_xowner_ptr;     ///< 所属的线程池对象
+        const size_t              m_xthread_index;  ///< 所属的线程索引号
+        x_ws_deque_t              m_xdeque;         ///< 工作线程本地的任务队列
+        x_locker_t                m_lock_inbox;     ///< 外部线程提交的任务队列的同步操作锁
+        x_task_list_t             m_lst_inbox;      ///< 外部线程提交至该工作线程的任务队列
+        std::atomic< size_t >     m_xst_inbox;      ///< m_lst_inbox 中的对象数量
+        uint32_t                  m_xrand_seed;     ///< 选取窃取对象的随机数种子
+    };
+
+    enum
+    {
+        ECV_WORKERS_LIMIT  = 4096, ///< 工作窃取模式下，拥有本地任务队列的工作线程上限数量
+        ECV_SCALE_UP_TICKS = 2,    ///< 弹性模式下，连续多少个检测周期超过阈值，才增加工作线程
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 当前线程（若为某个线程池的工作线程）所对应的 x_worker_t 对象。
+     */
+    static inline x_worker_t *& this_worker(void)
+    {
+        static thread_local x_worker_t * _S_this_worker = nullptr;
+        return _S_this_worker;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 当前线程（若为某个线程池的工作线程）所对应的 x_running_checker_t 对象。
+     */
+    static inline x_running_checker_t *& this_checker(void)
+    {
+        static thread_local x_running_checker_t * _S_this_checker = nullptr;
+        return _S_this_checker;
+    }
+
+    /**
+     * @struct x_worker_stats_t
+     * @brief  工作线程的统计计数（参看 x_worker_metrics_t）。
+     * @note   只由所属工作线程写入（无需原子的读-改-写操作），其他线程以 relaxed 方式读取；
+     *         前后填充，与槽位中的其他数据（及相邻的槽位）不共享缓存行。
+     */
+    struct x_worker_stats_t
+    {
+        x_worker_stats_t(void)
+            : m_xst_tasks(0)
+            , m_xst_busy_ns(0)
+            , m_xst_idle_ns(0)
+            , m_xst_parks(0)
+            , m_xst_wakeups(0)
+            , m_xst_get_fails(0)
+            , m_xst_skips(0)
+            , m_xst_steals(0)
+            , m_xst_sojourn_ns(0)
+        {
+            for (size_t xiter = 0; xiter < x_worker_metrics_t::ECV_HIST_BUCKETS; ++xiter)
+            {
+                m_xsojourn_hist[xiter].store(0, std::memory_order_relaxed);
+                m_xrun_hist[xiter].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 递增计数（只由所属工作线程调用）。
+         */
+        static inline void add(std::atomic< uint64_t > & xcounter, uint64_t xvalue = 1)
+        {
+            xcounter.store(xcounter.load(std::memory_order_relaxed) + xvalue, std::memory_order_relaxed);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 记录任务对象的排队时长与执行时长。
+         */
+        inline void add_sojourn(uint64_t xns)
+        {
+            add(m_xst_sojourn_ns, xns);
+            add(m_xsojourn_hist[x_worker_metrics_t::bucket_of(xns)]);
+        }
+
+        inline void add_run(uint64_t xns)
+        {
+            add(m_xst_busy_ns, xns);
+            add(m_xrun_hist[x_worker_metrics_t::bucket_of(xns)]);
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 读取各个计数（累加至 xmetrics）。
+         */
+        void collect(x_worker_metrics_t & xmetrics) const
+        {
+            xmetrics.tasks         += m_xst_tasks     .load(std::memory_order_relaxed);
+            xmetrics.busy_ns       += m_xst_busy_ns   .load(std::memory_order_relaxed);
+            xmetrics.idle_ns       += m_xst_idle_ns   .load(std::memory_order_relaxed);
+            xmetrics.parks         += m_xst_parks     .load(std::memory_order_relaxed);
+            xmetrics.wakeups       += m_xst_wakeups   .load(std::memory_order_relaxed);
+            xmetrics.get_failures  += m_xst_get_fails .load(std::memory_order_relaxed);
+            xmetrics.suspend_skips += m_xst_skips     .load(std::memory_order_relaxed);
+            xmetrics.steals        += m_xst_steals    .load(std::memory_order_relaxed);
+            xmetrics.sojourn_ns    += m_xst_sojourn_ns.load(std::memory_order_relaxed);
+            for (size_t xiter = 0; xiter < x_worker_metrics_t::ECV_HIST_BUCKETS; ++xiter)
+            {
+                xmetrics.sojourn_hist[xiter] += m_xsojourn_hist[xiter].load(std::memory_order_relaxed);
+                xmetrics.run_hist[xiter]     += m_xrun_hist[xiter].load(std::memory_order_relaxed);
+            }
+        }
+
+        char                    m_xpad1[64];
+        std::atomic< uint64_t > m_xst_tasks;      ///< 执行完成的任务对象数量
+        std::atomic< uint64_t > m_xst_busy_ns;    ///< 执行任务对象的时长
+        std::atomic< uint64_t > m_xst_idle_ns;    ///< 其余的运行时长
+        std::atomic< uint64_t > m_xst_parks;      ///< 挂起等待的次数
+        std::atomic< uint64_t > m_xst_wakeups;    ///< 空闲等待中被唤醒的次数
+        std::atomic< uint64_t > m_xst_get_fails;  ///< 提取不到任务对象的次数
+        std::atomic< uint64_t > m_xst_skips;      ///< 跳过挂起的任务对象的次数
+        std::atomic< uint64_t > m_xst_steals;     ///< 窃取到任务对象的次数
+        std::atomic< uint64_t > m_xst_sojourn_ns; ///< 排队时长之和
+        std::atomic< uint64_t > m_xsojourn_hist[x_worker_metrics_t::ECV_HIST_BUCKETS];  ///< 排队时长的直方图
+        std::atomic< uint64_t > m_xrun_hist[x_worker_metrics_t::ECV_HIST_BUCKETS];      ///< 执行时长的直方图
+        char                    m_xpad2[64];
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 当前线程（若为某个线程池的工作线程）的统计计数。
+     */
+    static inline x_worker_stats_t *& this_stats(void)
+    {
+        static thread_local x_worker_stats_t * _S_this_stats = nullptr;
+        return _S_this_stats;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 单调时钟的当前时间点（纳秒）。
+     */
+    static inline uint64_t steady_ns(void)
+    {
+        return static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(
+                    std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * @struct x_thread_slot_t
+     * @brief  工作线程对象的槽位（槽位的次序即线程索引号；工作线程退出并被 join 后，槽位可复用）。
+     */
+    struct x_thread_slot_t
+    {
+        x_thread_slot_t(size_t xthread_index)
+            : m_xthread_index(xthread_index)
+            , m_xexited(false)
+            , m_xcpu(-1)
+        {
+
+        }
+
+        const size_t          m_xthread_index;  ///< 线程索引号
+        std::thread           m_xthread;        ///< 工作线程对象（不可 join 时，槽位为空）
+        std::atomic< bool >   m_xexited;        ///< 工作线程是否已退出（可立即 join）
+        std::atomic< int >    m_xcpu;           ///< 工作线程绑定的逻辑 CPU 编号（未绑定至单个 CPU 时为 -1）
+        x_worker_stats_t      m_xstats;         ///< 该槽位上（历次运行的）工作线程的统计计数
+    };
+
+    /**
+     * @struct x_resize_state_t
+     * @brief  resize_async() 的共享状态：工作线程数量不超过 m_xthds 时完成（由最后退出的工作线程设置）。
+     */
+    struct x_resize_state_t : public x_result_void_t
+    {
+        x_resize_state_t(size_t xthds) : m_xthds(xthds) { }
+
+        virtual void run(x_running_checker_t * xchecker_ptr) override
+        {
+            // 不提交至线程池，由退出的工作线程推进
+        }
+
+        const size_t m_xthds;   ///< 目标的工作线程数量
+    };
+
+    // common invoking
+public:
+    /**********************************************************/
+    /**
+     * @brief 返回硬件线程上下文的数量。
+     */
+    static inline size_t hardware_concurrency(void) noexcept
+    {
+        return std::thread::hardware_concurrency();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回内部任务对象分配器的命中/未命中统计值（进程内所有线程池共用该分配器）。
+     * @note  可据此判断缓存容量是否足够：稳态下 misses 与 releases 应基本不再增长。
+     */
+    static inline x_alloc_stats_t alloc_stats(void)
+    {
+        return x_task_alloc_t::stats();
+    }
+
+    // constructor/destructor
+public:
+    explicit x_threadpool_t(void) noexcept
+        : m_enable_running(false)
+        , m_xthds_state(0)
+        , m_xst_threads(0)
+        , m_xaffinity_policy(ECV_AFFINITY_NONE)
+        , m_xnuma_nodes(0)
+        , m_xmin_thds(1)
+        , m_xmax_thds(0)
+        , m_xscale_depth(0)
+        , m_xscale_sojourn(0)
+        , m_xscale_interval(10)
+        , m_xkeep_alive(0)
+        , m_xscaler_stop(0)
+        , m_xidle_top(nullptr)
+        , m_check_suspened(false)
+        , m_work_stealing(false)
+        , m_xworker_count(0)
+        , m_xrr_index(0)
+        , m_xpriorities(1)
+        , m_xlane_count(0)
+        , m_xaging_quota(0)
+        , m_xst_low_skips(0)
+        , m_xst_prio_tasks(0)
+        , m_xtimer_wheel(nullptr)
+        , m_xcap_enabled(false)
+        , m_xcap_tasks(0)
+        , m_xcap_bytes(0)
+        , m_xcap_policy(ECV_OVERFLOW_BLOCK)
+        , m_xst_cap_waiters(0)
+        , m_xst_cap_tasks(0)
+        , m_xst_cap_bytes(0)
+        , m_xst_idle_thds(0)
+        , m_xidle_policy(ECV_IDLE_ADAPTIVE)
+        , m_xst_parked(0)
+        , m_xpark_epoch(0)
+        , m_xst_get_task(0)
+        , m_xst_lst_tasks(0)
+        , m_xst_task_count(0)
+        , m_xidle_epoch(0)
+        , m_xst_idle_waiters(0)
+        , m_xtiming(false)
+        , m_xtm_created(steady_ns())
+        , m_xst_submitted(0)
+#if XTHREADPOOL_ENABLE_TRACE
+        , m_xtracing(false)
+        , m_xtrace_capacity(0)
+        , m_xtrace_since(0)
+#endif // XTHREADPOOL_ENABLE_TRACE
+#if XTHREADPOOL_HAS_COROUTINE
+        , m_xframe_alloc(nullptr)
+#endif // XTHREADPOOL_HAS_COROUTINE
+    {
+
+    }
+
+    ~x_threadpool_t(void)
+    {
+        // 先停止定时线程，不再提交到期的任务对象
+        delete m_xtimer_wheel.load();
+        m_xtimer_wheel.store(nullptr);
+
+        if (is_startup() || m_xscaler.joinable())
+            shutdown();
+        cleanup_task();
+
+        for (size_t xiter = 0, xcount = m_xworker_count.load(); xiter < xcount; ++xiter)
+        {
+            delete m_xworker_table[xiter].load();
+        }
+
+#if XTHREADPOOL_HAS_COROUTINE
+        // 尚未释放的协程帧仍持有分配器的引用
+        x_frame_alloc_t * xalloc_ptr = m_xframe_alloc.load();
+        if (nullptr != xalloc_ptr)
+            xalloc_ptr->release();
+#endif // XTHREADPOOL_HAS_COROUTINE
+    }
+
+    x_threadpool_t(x_threadpool_t && xobject) = delete;
+    x_threadpool_t & operator=(x_threadpool_t && xobject) = delete;
+    x_threadpool_t(const x_threadpool_t & xobject) = delete;
+    x_threadpool_t & operator=(const x_threadpool_t & xobject) = delete;
+
+    // public interfaces
+public:
+    /**********************************************************/
+    /**
+     * @brief 启动线程池。
+     * 
+     * @param [in ] xthds          : 工作线程的数量（若为 0，将取 hardware_concurrency() 返回值的 2倍 + 1）。
+     * @param [in ] check_suspened : 是否检测任务对象的挂起状态。
+     * 
+     * @return bool
+     *         - 成功，返回 true；
+     *         - 失败，返回 false。
+     */
+    bool startup(size_t xthds = 0, bool check_suspened = false)
+    {
+        x_config_t xconfig;
+        xconfig.xthds          = xthds;
+        xconfig.check_suspened = check_suspened;
+
+        return startup(xconfig);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 启动线程池。
+     * 
+     * @param [in ] xconfig : 线程池的启动参数（参看 x_config_t 的说明）。
+     * 
+     * @return bool
+     *         - 成功，返回 true；
+     *         - 失败，返回 false。
+     */
+    bool startup(const x_config_t & xconfig)
+    {
+        // 检测当前是否已经启动
+        if (is_startup())
+            return false;
+
+        // 以 resize(0) 停止后再次启动的，上次的控制线程可能仍在运行（读取弹性参数、亲和性设置等），
+        // 须在改写任何配置之前将其停止
+        stop_scaler();
+
+        // 启动各个工作线程
+        try
+        {
+            m_check_suspened = xconfig.check_suspened;
+            m_work_stealing  = ((xconfig.work_stealing || xconfig.numa_aware) && !xconfig.check_suspened);
+
+            // 回收上次运行时遗留在工作线程本地队列中的任务对象
+            for (size_t xiter = 0, xcount = m_xworker_count.load(); xiter < xcount; ++xiter)
+            {
+                reclaim_worker_tasks(m_xworker_table[xiter].load());
+            }
+
+            // 回收环形提交队列中的任务对象，再按新的启动参数重建该队列
+            reclaim_ring_tasks();
+            size_t xring_capacity = xconfig.check_suspened ? 0 : xconfig.ring_capacity;
+            if (0 == xring_capacity)
+            {
+                m_xring.reset();
+            }
+            else if (!m_xring || (m_xring->capacity() < xring_capacity))
+            {
+                m_xring.reset(new x_task_ring_t(xring_capacity));
+            }
+
+            // 准备高优先级任务对象的车道
+            create_lanes(xconfig.priorities);
+            m_xaging_quota = xconfig.aging_quota;
+
+            // 容量限制（已计入容量统计的任务对象，在其执行完成后照常归还）
+            m_xcap_tasks   = xconfig.max_tasks;
+            m_xcap_bytes   = xconfig.max_bytes;
+            m_xcap_policy  = xconfig.overflow_policy;
+            m_xcap_enabled = ((0 != m_xcap_tasks) || (0 != m_xcap_bytes));
+
+            m_xidle_policy = xconfig.idle_policy;
+            m_xtiming      = xconfig.timing_metrics;
+
+            // 弹性模式：初始数量限定在 [min_threads, max_threads] 之内（未指定时，取下限数量）
+            size_t xthds = xconfig.xthds;
+            m_xmin_thds  = (xconfig.min_threads > 0) ? xconfig.min_threads : 1;
+            m_xmax_thds  = xconfig.max_threads;
+            if (0 != m_xmax_thds)
+            {
+                if (m_xmax_thds < m_xmin_thds)
+                    m_xmax_thds = m_xmin_thds;
+                xthds = (0 == xthds) ? m_xmin_thds : ((xthds < m_xmin_thds) ? m_xmin_thds : ((xthds > m_xmax_thds) ? m_xmax_thds : xthds));
+
+                m_xscale_depth    = xconfig.scale_up_depth;
+                m_xscale_sojourn  = xconfig.scale_up_sojourn;
+                m_xscale_interval = (xconfig.scale_interval.count() > 0) ? xconfig.scale_interval : std::chrono::milliseconds(1);
+                m_xkeep_alive     = xconfig.keep_alive;
+            }
+            else
+            {
+                m_xkeep_alive = std::chrono::milliseconds(0);
+            }
+
+            // 工作线程的 CPU 亲和性
+            m_xaffinity_policy = xconfig.affinity_policy;
+            switch (m_xaffinity_policy)
+            {
+            case ECV_AFFINITY_COMPACT:
+            case ECV_AFFINITY_SCATTER:
+                m_vec_affinity = nsaffinity::X_order_cpus(nsaffinity::X_allowed_cpus(),
+                                                          (ECV_AFFINITY_SCATTER == m_xaffinity_policy));
+                break;
+            case ECV_AFFINITY_LIST:
+                m_vec_affinity = xconfig.affinity_cpus;
+                break;
+            case ECV_AFFINITY_CPUSET:
+                m_vec_affinity = nsaffinity::X_order_cpus(nsaffinity::X_allowed_cpus(), false);
+                break;
+            default:
+                m_vec_affinity.clear();
+                break;
+            }
+            if (m_vec_affinity.empty())
+            {
+                m_xaffinity_policy = ECV_AFFINITY_NONE;
+            }
+
+            // NUMA 模式：工作线程按 线程索引号 % 节点数量 分组，各组限定在所属节点的逻辑 CPU 内
+            m_xnuma_nodes = 0;
+            if (m_work_stealing && xconfig.numa_aware)
+            {
+                m_vec_numa_cpus = nsaffinity::X_numa_nodes();
+                m_xnuma_nodes   = m_vec_numa_cpus.size();
+                m_xnode_rr.reset(new std::atomic< size_t >[m_xnuma_nodes]());
+
+                m_vec_cpu_node.clear();
+                for (size_t xnode = 0; xnode < m_xnuma_nodes; ++xnode)
+                {
+                    for (int xcpu : m_vec_numa_cpus[xnode])
+                    {
+                        if (static_cast< size_t >(xcpu) >= m_vec_cpu_node.size())
+                            m_vec_cpu_node.resize(xcpu + 1, -1);
+                        m_vec_cpu_node[xcpu] = static_cast< int >(xnode);
+                    }
+                }
+
+                m_xaffinity_policy = ECV_AFFINITY_NONE;
+                m_vec_affinity.clear();
+            }
+
+            m_xst_get_task.store(0);
+            resize((0 != xthds) ? xthds : (2 * hardware_concurrency() + 1));
+
+            if (0 != m_xmax_thds)
+            {
+                m_xscaler_stop.store(0);
+                m_xscaler = std::thread([this](void) -> void { scaler_run(); });
+            }
+        }
+        catch(...)
+        {
+            shutdown();
+            return false;
+        }
+
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 关闭线程池。
+     */
+    void shutdown(void)
+    {
+        // 先停止弹性模式的控制线程，不再增加工作线程
+        stop_scaler();
+
+        try
+        {
+            resize(0);
+        }
+        catch(...)
+        {
+
+        }
+
+        // 唤醒因容量已满而等待的提交方线程
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_capacity);
+        }
+        m_xcap_notifier.notify_all();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 判断是否已经启动。
+     */
+    inline bool is_startup(void) const
+    {
+        return (is_enable_running() && (size() > 0));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回 线程池对象是否可继续运行 的标识。
+     */
+    inline bool is_enable_running(void) const { return m_enable_running.load(std::memory_order_acquire); }
+
+    /**********************************************************/
+    /**
+     * @brief 返回工作线程数量（不加锁；resize() 减少数量后，随工作线程的退出逐步降至目标数量）。
+     */
+    inline size_t size(void) const
+    {
+        return thds_live(m_xthds_state.load(std::memory_order_acquire));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 调整工作线程数量。
+     * @note
+     * <pre>
+     *   增加数量时，先撤销尚未生效的减少操作，不足的部分再创建新的工作线程；
+     *   减少数量时，不等待工作线程退出，立即返回：空闲的工作线程被唤醒后退出，
+     *   执行中的工作线程则在完成当前的任务对象后退出（先空闲的先退出，与线程索引号无关）；
+     *   xthds 为 0 时（即 shutdown()），通知所有工作线程退出，并等待其全部结束。
+     *   需要等待减少操作完成的，可使用 resize_async() 接口。
+     * </pre>
+     */
+    void resize(size_t xthds)
+    {
+        std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
+        resize_workers(xthds);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 调整工作线程数量（参看 resize()），返回的 x_future_t 对象
+     *        在工作线程数量不超过 xthds（多余的工作线程均已退出）时完成。
+     * @note  之后再次调用 resize() 增加数量（撤销了本次的减少操作）时，同样视为完成。
+     */
+    x_future_t< void > resize_async(size_t xthds)
+    {
+        x_resize_state_t * xstate_ptr = new x_resize_state_t(xthds);
+        x_future_t< void > xfuture(this, xstate_ptr);
+
+        bool xready = false;
+        {
+            std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
+            resize_workers(xthds);
+
+            std::lock_guard< x_locker_t > xautolock(m_lock_retire);
+            xready = (m_xst_threads <= xthds);
+            if (!xready)
+                m_vec_resizes.push_back(xstate_ptr);
+        }
+
+        // 在锁外完成（后续操作可能再次调用 resize()）
+        if (xready)
+        {
+            xstate_ptr->set_ready(x_result_base_t::ECV_VALUE);
+            xstate_ptr->release();
+        }
+
+        return xfuture;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交任务对象。
+     * @note  启用容量限制（x_config_t::max_tasks/max_bytes）时，达到上限后按 x_config_t::overflow_policy 处理。
+     */
+    void submit_task(x_task_ptr_t xtask_ptr)
+    {
+        if ((nullptr != xtask_ptr) && admit_task(xtask_ptr))
+        {
+            push_task(xtask_ptr);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 尝试提交任务对象（达到容量上限时，不阻塞，也不按处理策略操作）。
+     * 
+     * @return bool
+     *         - 提交成功，返回 true；
+     *         - 已达到容量上限，返回 false（任务对象仍归调用方所有）。
+     */
+    bool try_submit(x_task_ptr_t xtask_ptr)
+    {
+        if ((nullptr == xtask_ptr) || !try_admit(xtask_ptr))
+        {
+            return false;
+        }
+
+        push_task(xtask_ptr);
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 尝试提交任务对象（泛型接口，参数同 submit_task_ex()；参看 try_submit() 接口的说明）。
+     * @note  提交失败时，所创建的任务对象随即被删除。
+     */
+    template< typename _Func, typename... _Args >
+    bool try_submit_ex(_Func && xfunc, _Args && ... xargs)
+    {
+        constexpr size_t const xchecker_count =
+                nstuple::X_type_count<
+                    x_running_checker_t::x_holder_t,
+                    typename std::decay< _Args >::type... >::value;
+
+        static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
+
+        x_task_ptr_t xtask_ptr = make_task(
+                                    x_task_maker_t< xchecker_count >(),
+                                    std::forward< _Func >(xfunc),
+                                    std::forward< _Args >(xargs)...);
+        if (!try_submit(xtask_ptr))
+        {
+            recycle_task(xtask_ptr);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回容量统计中，已提交、尚未执行完成的任务对象数量与内存估算值（未启用容量限制时，均为 0）。
+     */
+    inline size_t capacity_tasks(void) const { return m_xst_cap_tasks; }
+    inline size_t capacity_bytes(void) const { return m_xst_cap_bytes; }
+
+    /**********************************************************/
+    /**
+     * @brief 按优先级提交任务对象。
+     * 
+     * @param [in ] xtask_ptr : 任务对象。
+     * @param [in ] xpriority : 优先级（数值越大越优先；超出 [0, priorities()) 时，取最高的优先级）。
+     * 
+     * @note
+     * <pre>
+     *   工作线程总是先从优先级最高的非空队列中提取任务对象；为避免低优先级的
+     *   任务对象被“饿死”，可通过 x_config_t::aging_quota 设置老化的阈值。
+     *   同一优先级内按提交次序提取；优先级为 0 时，等同于 submit_task(xtask_ptr)。
+     * </pre>
+     */
+    void submit_task(x_task_ptr_t xtask_ptr, size_t xpriority)
+    {
+        if (xpriority >= m_xpriorities)
+        {
+            xpriority = m_xpriorities - 1;
+        }
+
+        if ((nullptr == xtask_ptr) || (0 == xpriority))
+        {
+            submit_task(xtask_ptr);
+            return;
+        }
+
+        if (!admit_task(xtask_ptr))
+        {
+            return;
+        }
+
+        x_lane_t & xlane = m_xlanes[xpriority - 1];
+        count_enqueue(xtask_ptr);
+
+        // 先递增计数，避免任务对象在被执行完成后才递增（计数值出现下溢）
+        xlane.m_xst_tasks.fetch_add(1);
+        m_xst_prio_tasks.fetch_add(1);
+        m_xst_lst_tasks.fetch_add(1);
+        m_xst_task_count.fetch_add(1);
+
+        xlane.m_lst_smt_tasks.push(xtask_ptr);
+
+        notify_idle_worker();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交任务对象（支持 仿函数对象 与 lambda 表达式 等类函数的泛型接口）。
+     * 
+     * @note xfunc 的回调操作过程中，若需要进行运行时检测（判断工作线程是否可继续运行），
+     * 可在 xargs 参数列表中添加一个（且最多一个） x_running_checker_t::x_holder_t 
+     * 占位对象。
+     */
+    template< typename _Func, typename... _Args >
+    void submit_task_ex(_Func && xfunc, _Args && ... xargs)
+    {
+        constexpr size_t const xchecker_count =
+                nstuple::X_type_count<
+                    x_running_checker_t::x_holder_t,
+                    typename std::decay< _Args >::type... >::value;
+
+        static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
+
+        submit_task(make_task(
+                        x_task_maker_t< xchecker_count >(),
+                        std::forward< _Func >(xfunc),
+                        std::forward< _Args >(xargs)...));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交任务对象，并返回用于获取其执行结果的 x_future_t 对象
+     *        （泛型接口，参数同 submit_task_ex()，但不支持 x_running_checker_t::x_holder_t 占位对象）。
+     * @note
+     * <pre>
+     *   执行结果的共享状态直接存放于任务对象内（只有一次内存分配），
+     *   无需 std::packaged_task 与 std::future 额外的共享状态、互斥锁与条件变量；
+     *   执行过程中抛出的异常，由 x_future_t::get() 重新抛出。
+     *   返回值类型为 xfunc(xargs...) 的返回值类型去除引用与 cv 限定后的类型。
+     * </pre>
+     */
+    template< typename _Func, typename... _Args >
+    auto submit_with_result(_Func && xfunc, _Args && ... xargs)
+        -> x_future_t< typename std::decay< typename x_invoker_of< _Func, _Args... >::_Result >::type >
+    {
+        using _Invoker = x_invoker_of< _Func, _Args... >;
+        using _Result  = typename std::decay< typename _Invoker::_Result >::type;
+
+        x_result_task_t< _Result, _Invoker > * xtask_ptr =
+            new x_result_task_t< _Result, _Invoker >(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+
+        // 先构建 x_future_t 对象（持有一个引用），提交后任务对象可能立即执行完成
+        x_future_t< _Result > xfuture(this, xtask_ptr);
+        submit_task(xtask_ptr);
+        return xfuture;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 所有 x_future_t 对象（[ xiter_first, xiter_last ) 区间）都完成后，
+     *        返回的 x_future_t 对象才完成，其结果为移入的所有 x_future_t 对象。
+     * @note
+     * <pre>
+     *   不占用工作线程：由完成最后一个前驱的线程设置完成状态（并执行其后续操作）。
+     *   区间内的 x_future_t 对象被移走（不再有效）。
+     * </pre>
+     */
+    template< typename _Iter >
+    auto when_all(_Iter xiter_first, _Iter xiter_last)
+        -> x_future_t< std::vector< typename std::iterator_traits< _Iter >::value_type > >
+    {
+        using _Seq = std::vector< typename std::iterator_traits< _Iter >::value_type >;
+
+        _Seq xseq;
+        for (; xiter_first != xiter_last; ++xiter_first)
+        {
+            xseq.push_back(std::move(*xiter_first));
+        }
+
+        std::vector< x_result_base_t * > xvec_prev;
+        for (auto & xfuture : xseq)
+        {
+            xvec_prev.push_back(xfuture.m_xstate_ptr);
+        }
+
+        return make_when< false >(std::move(xseq), xvec_prev.data(), xvec_prev.size());
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 所有 x_future_t 对象（返回值类型可各不相同）都完成后，
+     *        返回的 x_future_t 对象才完成，其结果为移入的所有 x_future_t 对象（std::tuple）。
+     */
+    template< typename... _Tys >
+    auto when_all(x_future_t< _Tys > && ... xfutures)
+        -> x_future_t< std::tuple< x_future_t< _Tys >... > >
+    {
+        x_result_base_t * xprev[sizeof...(_Tys) + 1] = { xfutures.m_xstate_ptr..., nullptr };
+        return make_when< false >(std::make_tuple(std::move(xfutures)...), xprev, sizeof...(_Tys));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 任一 x_future_t 对象（[ xiter_first, xiter_last ) 区间）完成后，返回的 x_future_t 对象即完成，
+     *        其结果为最先完成者的索引号与移入的所有 x_future_t 对象（参看 x_when_any_t）。
+     */
+    template< typename _Iter >
+    auto when_any(_Iter xiter_first, _Iter xiter_last)
+        -> x_future_t< x_when_any_t< std::vector< typename std::iterator_traits< _Iter >::value_type > > >
+    {
+        using _Seq = std::vector< typename std::iterator_traits< _Iter >::value_type >;
+
+        _Seq xseq;
+        for (; xiter_first != xiter_last; ++xiter_first)
+        {
+            xseq.push_back(std::move(*xiter_first));
+        }
+
+        std::vector< x_result_base_t * > xvec_prev;
+        for (auto & xfuture : xseq)
+        {
+            xvec_prev.push_back(xfuture.m_xstate_ptr);
+        }
+
+        return make_when< true >(std::move(xseq), xvec_prev.data(), xvec_prev.size());
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交依赖图执行一次，返回其 x_future_t 对象（所有节点结束后完成）。
+     * @note
+     * <pre>
+     *   起始节点经 submit_task() 提交；其余节点由完成其最后一个前驱的工作线程直接加入任务队列。
+     *   依赖图存在环时，返回的 x_future_t 对象存放 std::invalid_argument 异常。
+     *   同一依赖图可同时执行多次；依赖图对象须在执行完成前保持有效。
+     * </pre>
+     */
+    x_future_t< void > submit_graph(const x_task_graph_t & xgraph)
+    {
+        bool xacyclic = xgraph.is_acyclic();
+
+        x_graph_run_t * xrun_ptr = new x_graph_run_t(this, xacyclic ? xgraph : x_task_graph_t::empty_graph());
+        x_future_t< void > xfuture(this, xrun_ptr);
+
+        if (!xacyclic)
+        {
+            xrun_ptr->set_exception(std::make_exception_ptr(std::invalid_argument("x_task_graph_t has a cycle")));
+        }
+        else if (0 == xgraph.size())
+        {
+            xrun_ptr->set_ready(x_result_base_t::ECV_VALUE);
+        }
+        else
+        {
+            xrun_ptr->start();
+        }
+
+        return xfuture;
+    }
+
+#if XTHREADPOOL_HAS_COROUTINE
+
+    /**********************************************************/
+    /**
+     * @brief 返回可等待对象：co_await pool.schedule() 挂起当前协程，并在工作线程中恢复执行。
+     * @note
+     * <pre>
+     *   恢复执行的任务对象经 submit_task() 提交（受容量限制及其处理策略的约束）；
+     *   该任务对象未执行就被丢弃时，co_await 表达式抛出 std::future_errc::broken_promise 异常。
+     * </pre>
+     */
+    x_schedule_awaiter_t schedule(void)
+    {
+        return x_schedule_awaiter_t(this);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交协程至线程池启动执行，返回其 x_future_t 对象（协程结束后完成）。
+     * @note  协程在工作线程中启动；其后的执行线程取决于协程内部的 co_await 操作。
+     */
+    template< typename _Ty >
+    x_future_t< _Ty > submit_coroutine(x_co_task_t< _Ty > xtask)
+    {
+        if (!xtask.valid())
+        {
+            throw std::future_error(std::future_errc::no_state);
+        }
+
+        x_co_spawn_task_t< _Ty > * xtask_ptr = new x_co_spawn_task_t< _Ty >(xtask.m_xhandle);
+        xtask.m_xhandle = nullptr;
+
+        x_future_t< _Ty > xfuture(this, xtask_ptr);
+        submit_task(xtask_ptr);
+        return xfuture;
+    }
+
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+    /**********************************************************/
+    /**
+     * @brief 批量提交任务对象（[ xiter_first, xiter_last ) 区间内的 x_task_ptr_t 对象）。
+     * @note
+     * <pre>
+     *   整批任务对象先在本地链接好，再一次性加入任务队列，计数值只更新一次，
+     *   并且只唤醒 min(任务数量, 等待中的工作线程数量) 个工作线程。
+     * </pre>
+     * 
+     * @return size_t : 返回所提交的任务对象数量（忽略 nullptr 对象）。
+     */
+    template< typename _Iter >
+    size_t submit_tasks(_Iter xiter_first, _Iter xiter_last)
+    {
+        size_t xst_count = 0;
+
+        x_task_list_t xlst_tasks;
+        for (; xiter_first != xiter_last; ++xiter_first)
+        {
+            x_task_ptr_t xtask_ptr = *xiter_first;
+            if (nullptr == xtask_ptr)
+            {
+                continue;
+            }
+
+            xst_count += 1;
+            if (!try_admit(xtask_ptr))
+            {
+                // 达到容量上限：先提交已链接的任务对象（其已占用容量），再按处理策略操作
+                if (!xlst_tasks.empty())
+                    submit_task_list(xlst_tasks);
+                if (!admit_task(xtask_ptr))
+                    continue;
+            }
+
+            xlst_tasks.push_back(xtask_ptr);
+        }
+
+        if (!xlst_tasks.empty())
+        {
+            submit_task_list(xlst_tasks);
+        }
+
+        return xst_count;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 批量提交任务对象（以变参形式传入多个无参数的 仿函数对象 或 lambda 表达式 等）。
+     * @note  参看 submit_tasks() 接口的说明。
+     */
+    template< typename... _Funcs >
+    size_t submit_tasks_ex(_Funcs && ... xfuncs)
+    {
+        // 先由智能指针托管，避免中途创建失败（抛出异常）时，已创建的任务对象泄露
+        std::unique_ptr< x_task_t > xholders[] =
+        {
+            std::unique_ptr< x_task_t >(make_task(x_task_maker_t< 0 >(), std::forward< _Funcs >(xfuncs)))...
+        };
+
+        x_task_ptr_t xtasks[sizeof...(_Funcs)];
+        for (size_t xiter = 0; xiter < sizeof...(_Funcs); ++xiter)
+        {
+            xtasks[xiter] = xholders[xiter].release();
+        }
+
+        return submit_tasks(xtasks, xtasks + sizeof...(_Funcs));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 按优先级提交任务对象（泛型接口，参数同 submit_task_ex()）。
+     * @note  参看 submit_task(x_task_ptr_t, size_t) 接口的说明。
+     */
+    template< typename _Func, typename... _Args >
+    void submit_priority(size_t xpriority, _Func && xfunc, _Args && ... xargs)
+    {
+        constexpr size_t const xchecker_count =
+                nstuple::X_type_count<
+                    x_running_checker_t::x_holder_t,
+                    typename std::decay< _Args >::type... >::value;
+
+        static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
+
+        submit_task(make_task(
+                        x_task_maker_t< xchecker_count >(),
+                        std::forward< _Func >(xfunc),
+                        std::forward< _Args >(xargs)...),
+                    xpriority);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 按键值提交需要串行执行的任务对象。
+     * @note
+     * <pre>
+     *   键值相同的任务对象，按提交次序逐个执行（同一时刻最多只有一个在执行）；
+     *   键值不同的任务对象之间，则可并发执行。键值以 std::hash< _Key > 计算出的
+     *   哈希值进行区分（哈希值相同的键值，视为同一序列）。
+     *   与 startup() 的 check_suspened 参数无关，可在任何调度模式下使用。
+     * </pre>
+     */
+    template< typename _Key >
+    void submit_ordered_task(const _Key & xkey, x_task_ptr_t xtask_ptr)
+    {
+        if (nullptr == xtask_ptr)
+        {
+            return;
+        }
+
+        // 不可在提交方线程中直接执行（会打乱序列的执行次序）
+        admit_task(xtask_ptr, false);
+
+        size_t xhash = std::hash< _Key >()(xkey);
+        x_strand_shard_t & xshard = strand_shard(xhash);
+
+        {
+            std::lock_guard< x_locker_t > xautolock(xshard.m_xlock);
+
+            x_strand_t & xstrand = xshard.m_xmap[xhash];
+            xtask_ptr->m_xstrand_ptr = &xstrand;
+
+            if (xstrand.m_xactive)
+            {
+                // 序列中已有任务对象放行，暂存于序列中（计入任务对象总数量）
+                xstrand.m_lst_tasks.push_back(xtask_ptr);
+                m_xst_task_count.fetch_add(1);
+                return;
+            }
+
+            xstrand.m_xkey    = xhash;
+            xstrand.m_xactive = true;
+        }
+
+        push_task(xtask_ptr);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 按键值提交需要串行执行的任务对象（泛型接口，参数同 submit_task_ex()）。
+     * @note  参看 submit_ordered_task() 接口的说明。
+     */
+    template< typename _Key, typename _Func, typename... _Args >
+    void submit_ordered(const _Key & xkey, _Func && xfunc, _Args && ... xargs)
+    {
+        constexpr size_t const xchecker_count =
+                nstuple::X_type_count<
+                    x_running_checker_t::x_holder_t,
+                    typename std::decay< _Args >::type... >::value;
+
+        static_assert(xchecker_count < 2, "Too many arguments [x_running_checker_t::xholder()]");
+
+        submit_ordered_task(xkey, make_task(
+                                    x_task_maker_t< xchecker_count >(),
+                                    std::forward< _Func >(xfunc),
+                                    std::forward< _Args >(xargs)...));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 延迟指定时长后，提交任务对象（泛型接口，参数同 submit_task_ex()，
+     *        但不支持 x_running_checker_t::x_holder_t 占位对象）。
+     * @note
+     * <pre>
+     *   定时器由线程池内部的分层时间轮管理（时间刻度为 1 毫秒），
+     *   首次提交定时任务时，才创建时间轮并启动定时线程；
+     *   定时器到期后，回调操作作为普通的任务对象提交至线程池执行。
+     * </pre>
+     * 
+     * @return x_timer_t : 定时器的句柄，可用于取消定时器。
+     */
+    template< typename _Rep, typename _Period, typename _Func, typename... _Args >
+    x_timer_t submit_after(const std::chrono::duration< _Rep, _Period > & xdelay, _Func && xfunc, _Args && ... xargs)
+    {
+        x_timer_node_t * xnode_ptr = make_timer(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+        x_timer_wheel_t * xwheel_ptr = timer_wheel();
+        return add_timer(xnode_ptr,
+                         xwheel_ptr->to_tick(std::chrono::steady_clock::now()) +
+                            x_timer_wheel_t::to_ticks(xdelay),
+                         0);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 在指定时间点，提交任务对象（参看 submit_after() 接口的说明）。
+     * @note  非 steady_clock 的时间点，按提交时与当前时间的差值进行换算。
+     */
+    template< typename _Clock, typename _Duration, typename _Func, typename... _Args >
+    x_timer_t submit_at(const std::chrono::time_point< _Clock, _Duration > & xtime, _Func && xfunc, _Args && ... xargs)
+    {
+        return submit_after(xtime - _Clock::now(), std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 按指定周期，重复提交任务对象（首次在一个周期后提交；参看 submit_after() 接口的说明）。
+     * @note
+     * <pre>
+     *   周期最小为 1 毫秒；错过的周期不再补偿。回调操作耗时超过周期时，
+     *   多次回调可能在不同的工作线程中并发执行。调用返回的句柄的 cancel() 停止该定时器。
+     * </pre>
+     */
+    template< typename _Rep, typename _Period, typename _Func, typename... _Args >
+    x_timer_t submit_every(const std::chrono::duration< _Rep, _Period > & xperiod, _Func && xfunc, _Args && ... xargs)
+    {
+        uint64_t xticks = x_timer_wheel_t::to_ticks(xperiod);
+        if (0 == xticks)
+            xticks = 1;
+
+        x_timer_node_t * xnode_ptr = make_timer(std::forward< _Func >(xfunc), std::forward< _Args >(xargs)...);
+        x_timer_wheel_t * xwheel_ptr = timer_wheel();
+        return add_timer(xnode_ptr, xwheel_ptr->to_tick(std::chrono::steady_clock::now()) + xticks, xticks);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回尚未到期（包括周期性的）定时器的数量。
+     */
+    inline size_t timer_count(void) const
+    {
+        x_timer_wheel_t * xwheel_ptr = m_xtimer_wheel.load(std::memory_order_acquire);
+        return (nullptr != xwheel_ptr) ? xwheel_ptr->size() : 0;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回任务对象数量。
+     */
+    inline size_t task_count(void) const { return m_xst_task_count; }
+
+    /**********************************************************/
+    /**
+     * @brief 返回处于等待状态（空闲）的工作线程数量。
+     * @note  只作为调度的参考值（如 parallel_for() 据此判断是否拆分任务区间）。
+     */
+    inline size_t idle_count(void) const { return m_xst_idle_thds.load(std::memory_order_relaxed); }
+
+    /**********************************************************/
+    /**
+     * @brief 获取运行统计的快照（参看 x_metrics_t；各个计数值分别读取，彼此之间不保证一致）。
+     * @note  不阻塞工作线程，也不与 resize() 互斥等待（可在任务对象中调用）。
+     */
+    x_metrics_t snapshot(void) const
+    {
+        x_metrics_t xmetrics;
+        xmetrics.elapsed_ns = steady_ns() - m_xtm_created;
+
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_metrics);
+
+            xmetrics.total = m_xretired_metrics;
+            xmetrics.workers.reserve(m_lst_threads.size());
+            for (const x_thread_slot_t & xslot : m_lst_threads)
+            {
+                xmetrics.workers.push_back(x_worker_metrics_t());
+                x_worker_metrics_t & xworker = xmetrics.workers.back();
+                xworker.thread_index = xslot.m_xthread_index;
+                xslot.m_xstats.collect(xworker);
+                xmetrics.total.merge(xworker);
+            }
+        }
+
+        // 先读取执行完成的数量，再读取入队的数量（前者不会超出后者）
+        xmetrics.completed    = xmetrics.total.tasks;
+        xmetrics.submitted    = m_xst_submitted.load(std::memory_order_relaxed);
+        xmetrics.threads      = size();
+        xmetrics.idle_threads = idle_count();
+        xmetrics.pending      = task_count();
+        xmetrics.timing       = m_xtiming;
+
+        return xmetrics;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 以 Prometheus 文本格式（text/plain; version=0.0.4）输出运行统计。
+     * 
+     * @param [in ] xmetrics    : snapshot() 返回的快照。
+     * @param [in ] xszt_prefix : 各项指标名称的前缀。
+     * 
+     * @note
+     * <pre>
+     *   各个工作线程的计数以 worker="线程索引号" 标签区分；排队时长与执行时长的直方图
+     *   只输出所有工作线程的汇总值（以秒为单位，分桶上界参看 x_worker_metrics_t）。
+     * </pre>
+     */
+    static std::string to_prometheus(const x_metrics_t & xmetrics, const char * xszt_prefix = "xthreadpool")
+    {
+        std::string xstr_text;
+        char        xszt_line[256];
+
+        auto xhead = [&](const char * xszt_name, const char * xszt_type, const char * xszt_help)
+        {
+            snprintf(xszt_line, sizeof(xszt_line), "# HELP %s_%s %s\n# TYPE %s_%s %s\n",
+                     xszt_prefix, xszt_name, xszt_help, xszt_prefix, xszt_name, xszt_type);
+            xstr_text += xszt_line;
+        };
+
+        auto xvalue = [&](const char * xszt_name, const char * xszt_type, const char * xszt_help, uint64_t xcount)
+        {
+            xhead(xszt_name, xszt_type, xszt_help);
+            snprintf(xszt_line, sizeof(xszt_line), "%s_%s %llu\n",
+                     xszt_prefix, xszt_name, static_cast< unsigned long long >(xcount));
+            xstr_text += xszt_line;
+        };
+
+        auto xworkers = [&](const char * xszt_name, const char * xszt_help, uint64_t x_worker_metrics_t::* xfield, bool xseconds)
+        {
+            xhead(xszt_name, "counter", xszt_help);
+            for (const x_worker_metrics_t & xworker : xmetrics.workers)
+            {
+                if (xseconds)
+                    snprintf(xszt_line, sizeof(xszt_line), "%s_%s{worker=\"%zu\"} %.9f\n",
+                             xszt_prefix, xszt_name, xworker.thread_index, (xworker.*xfield) * 1.0e-9);
+                else
+                    snprintf(xszt_line, sizeof(xszt_line), "%s_%s{worker=\"%zu\"} %llu\n",
+                             xszt_prefix, xszt_name, xworker.thread_index,
+                             static_cast< unsigned long long >(xworker.*xfield));
+                xstr_text += xszt_line;
+            }
+        };
+
+        auto xhistogram = [&](const char * xszt_name, const char * xszt_help, const uint64_t * xhist, uint64_t xsum_ns)
+        {
+            xhead(xszt_name, "histogram", xszt_help);
+
+            uint64_t xcount = 0;
+            for (size_t xiter = 0; xiter < x_worker_metrics_t::ECV_HIST_BUCKETS; ++xiter)
+            {
+                xcount += xhist[xiter];
+                if (xiter < x_worker_metrics_t::ECV_HIST_BUCKETS - 1)
+                    snprintf(xszt_line, sizeof(xszt_line), "%s_%s_bucket{le=\"%.9g\"} %llu\n",
+                             xszt_prefix, xszt_name, x_worker_metrics_t::bucket_bound(xiter) * 1.0e-9,
+                             static_cast< unsigned long long >(xcount));
+                else
+                    snprintf(xszt_line, sizeof(xszt_line), "%s_%s_bucket{le=\"+Inf\"} %llu\n",
+                             xszt_prefix, xszt_name, static_cast< unsigned long long >(xcount));
+                xstr_text += xszt_line;
+            }
+
+            snprintf(xszt_line, sizeof(xszt_line), "%s_%s_sum %.9f\n%s_%s_count %llu\n",
+                     xszt_prefix, xszt_name, xsum_ns * 1.0e-9,
+                     xszt_prefix, xszt_name, static_cast< unsigned long long >(xcount));
+            xstr_text += xszt_line;
+        };
+
+        xvalue("tasks_submitted_total", "counter", "Tasks enqueued into the pool.", xmetrics.submitted);
+        xvalue("tasks_completed_total", "counter", "Tasks completed by worker threads.", xmetrics.completed);
+        xvalue("tasks_pending", "gauge", "Tasks submitted but not yet completed.", xmetrics.pending);
+        xvalue("threads", "gauge", "Running worker threads.", xmetrics.threads);
+        xvalue("idle_threads", "gauge", "Worker threads waiting for tasks.", xmetrics.idle_threads);
+
+        xworkers("worker_tasks_total", "Tasks completed by the worker.", &x_worker_metrics_t::tasks, false);
+        xworkers("worker_busy_seconds_total", "Time spent running tasks.", &x_worker_metrics_t::busy_ns, true);
+        xworkers("worker_idle_seconds_total", "Time spent fetching or waiting for tasks.", &x_worker_metrics_t::idle_ns, true);
+        xworkers("worker_parks_total", "Times the worker blocked waiting for tasks.", &x_worker_metrics_t::parks, false);
+        xworkers("worker_wakeups_total", "Times the worker was woken from an idle wait.", &x_worker_metrics_t::wakeups, false);
+        xworkers("worker_get_failures_total", "Fetch attempts that found no runnable task.", &x_worker_metrics_t::get_failures, false);
+        xworkers("worker_suspend_skips_total", "Suspended tasks skipped while fetching.", &x_worker_metrics_t::suspend_skips, false);
+        xworkers("worker_steals_total", "Tasks stolen from other workers.", &x_worker_metrics_t::steals, false);
+
+        if (xmetrics.timing)
+        {
+            xhistogram("queue_sojourn_seconds", "Time from enqueue to start of execution.",
+                       xmetrics.total.sojourn_hist, xmetrics.total.sojourn_ns);
+            xhistogram("task_run_seconds", "Task execution time.",
+                       xmetrics.total.run_hist, xmetrics.total.busy_ns);
+        }
+
+        return xstr_text;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 在任务对象的执行过程中调用，设置其追踪记录中的任务标签
+     *        （xszt_label 须在导出追踪记录前一直有效，如字符串常量；优先于 x_task_t::trace_label()）。
+     * @note  未启用 XTHREADPOOL_ENABLE_TRACE，或不在工作线程中调用时，不做任何操作。
+     */
+    static inline void set_trace_label(const char * xszt_label)
+    {
+#if XTHREADPOOL_ENABLE_TRACE
+        if (nullptr != this_stats())
+            this_trace_label() = xszt_label;
+#else // !XTHREADPOOL_ENABLE_TRACE
+        (void)xszt_label;
+#endif // XTHREADPOOL_ENABLE_TRACE
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 开始记录任务对象的追踪记录：入队、被提取、开始执行、执行结束的时间点，
+     *        执行的工作线程，以及任务标签（参看 set_trace_label()、x_task_t::trace_label()）。
+     * 
+     * @param [in ] xcapacity : 每个工作线程最多保留的记录数量（向上取 2 的幂；写满后覆盖最早的记录）。
+     * 
+     * @note
+     * <pre>
+     *   须以 XTHREADPOOL_ENABLE_TRACE 为 1 编译，否则该接口不做任何操作。
+     *   导出时（参看 dump_trace()）只包含此后执行结束的记录。
+     * </pre>
+     */
+    void start_trace(size_t xcapacity = 4096)
+    {
+#if XTHREADPOOL_ENABLE_TRACE
+        size_t xsize = 2;
+        while (xsize < xcapacity)
+            xsize <<= 1;
+
+        m_xtrace_capacity.store(xsize, std::memory_order_relaxed);
+        m_xtrace_since.store(steady_ns(), std::memory_order_relaxed);
+        m_xtracing.store(true, std::memory_order_relaxed);
+#else // !XTHREADPOOL_ENABLE_TRACE
+        (void)xcapacity;
+#endif // XTHREADPOOL_ENABLE_TRACE
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 停止记录追踪记录（已记录的仍可导出）。
+     */
+    void stop_trace(void)
+    {
+#if XTHREADPOOL_ENABLE_TRACE
+        m_xtracing.store(false, std::memory_order_relaxed);
+#endif // XTHREADPOOL_ENABLE_TRACE
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 是否正在记录追踪记录。
+     */
+    inline bool is_tracing(void) const
+    {
+        return trace_enabled();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 以 Chrome 的 Trace Event 格式（JSON）导出追踪记录，可由 chrome://tracing 或 Perfetto 直接打开。
+     * @note
+     * <pre>
+     *   每个工作线程为一条轨迹（tid = 线程索引号 + 1）：
+     *   1. 执行过程：工作线程轨迹上的时长事件（args 中给出排队时长与提取至开始执行的时长）；
+     *   2. 排队过程：异步事件（入队至被提取；入队时尚未开始记录的，不输出该事件）。
+     *   时间点以线程池对象创建时为 0（单位：微秒）。导出时不阻塞工作线程，正被覆盖的记录将被跳过。
+     * </pre>
+     */
+    std::string dump_trace(void) const
+    {
+        std::string xstr_json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+#if XTHREADPOOL_ENABLE_TRACE
+        // xszt_line 只存放定长的部分（数值等），任务标签（长度不限）直接追加至 xstr_json
+        char xszt_line[256];
+        bool xfirst = true;
+
+        auto xappend = [&](void)
+        {
+            if (!xfirst)
+                xstr_json += ",\n";
+            xstr_json += xszt_line;
+            xfirst = false;
+        };
+
+        auto xappend_named = [&](const std::string & xstr_name)
+        {
+            if (!xfirst)
+                xstr_json += ",\n";
+            xstr_json += "{\"name\":\"";
+            xstr_json += xstr_name;
+            xstr_json += "\",";
+            xstr_json += xszt_line;
+            xfirst = false;
+        };
+
+        auto xus = [this](uint64_t xns) -> double
+        {
+            return (xns > m_xtm_created) ? ((xns - m_xtm_created) * 1.0e-3) : 0.0;
+        };
+
+        snprintf(xszt_line, sizeof(xszt_line),
+                 "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"x_threadpool_t\"}}");
+        xappend();
+
+        uint64_t xtm_since = m_xtrace_since.load(std::memory_order_relaxed);
+
+        std::lock_guard< x_locker_t > xautolock(m_lock_metrics);
+        for (size_t xindex = 0; xindex < m_vec_trace_rings.size(); ++xindex)
+        {
+            if (!m_vec_trace_rings[xindex])
+                continue;
+
+            snprintf(xszt_line, sizeof(xszt_line),
+                     "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"worker %zu\"}}",
+                     xindex + 1, xindex);
+            xappend();
+
+            m_vec_trace_rings[xindex]->visit(
+                [&](uint64_t xpos, const x_trace_record_t & xrecord)
+                {
+                    if (xrecord.m_xtm_end < xtm_since)
+                        return;
+
+                    std::string xstr_label;
+                    trace_escape(xstr_label, (nullptr != xrecord.m_xlabel) ? xrecord.m_xlabel : "task");
+
+                    uint64_t xid   = (static_cast< uint64_t >(xindex) << 40) | (xpos & ((static_cast< uint64_t >(1) << 40) - 1));
+                    bool     xwait = (0 != xrecord.m_xtm_submit) && (xrecord.m_xtm_submit <= xrecord.m_xtm_dequeue);
+
+                    snprintf(xszt_line, sizeof(xszt_line),
+                             "\"cat\":\"task\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,"
+                             "\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"queued_us\":%.3f,\"dequeue_to_start_us\":%.3f}}",
+                             xindex + 1, xus(xrecord.m_xtm_start),
+                             (xrecord.m_xtm_end - xrecord.m_xtm_start) * 1.0e-3,
+                             xwait ? ((xrecord.m_xtm_dequeue - xrecord.m_xtm_submit) * 1.0e-3) : 0.0,
+                             (xrecord.m_xtm_start - xrecord.m_xtm_dequeue) * 1.0e-3);
+                    xappend_named(xstr_label);
+
+                    if (!xwait)
+                        return;
+
+                    snprintf(xszt_line, sizeof(xszt_line),
+                             "\"cat\":\"queue\",\"ph\":\"b\",\"id\":%llu,\"pid\":1,\"tid\":%zu,\"ts\":%.3f}",
+                             static_cast< unsigned long long >(xid), xindex + 1, xus(xrecord.m_xtm_submit));
+                    xappend_named(xstr_label);
+
+                    snprintf(xszt_line, sizeof(xszt_line),
+                             "\"cat\":\"queue\",\"ph\":\"e\",\"id\":%llu,\"pid\":1,\"tid\":%zu,\"ts\":%.3f}",
+                             static_cast< unsigned long long >(xid), xindex + 1, xus(xrecord.m_xtm_dequeue));
+                    xappend_named(xstr_label);
+                });
+        }
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+        xstr_json += "]}\n";
+        return xstr_json;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若当前线程为本线程池的工作线程，返回其 x_running_checker_t 对象，否则返回 nullptr。
+     * @note  可据其 thread_index() 索引各个工作线程私有的数据（如 parallel_reduce() 的局部累加值）。
+     */
+    inline const x_running_checker_t * current_checker(void) const
+    {
+        const x_running_checker_t * xchecker_ptr = this_checker();
+        return ((nullptr != xchecker_ptr) && (this == xchecker_ptr->m_this_pool_ptr)) ? xchecker_ptr : nullptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 阻塞等待，直至所有任务对象执行完成（task_count() 降为 0）。
+     * @note
+     * <pre>
+     *   最后一个任务对象执行完成时，直接唤醒等待方（futex），无需轮询 task_count()。
+     *   尚未到期的定时器不计入其中；不可在工作线程中调用（会等待自身所执行的任务对象）。
+     * </pre>
+     */
+    void wait_idle(void)
+    {
+        wait_idle_until(nullptr);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 在指定时长内，等待所有任务对象执行完成（参看 wait_idle() 的说明）。
+     * 
+     * @return bool
+     *         - 所有任务对象已执行完成，返回 true；
+     *         - 超时，返回 false。
+     */
+    template< typename _Rep, typename _Period >
+    bool wait_idle_for(const std::chrono::duration< _Rep, _Period > & xtimeout)
+    {
+        std::chrono::steady_clock::time_point xtm_end =
+            std::chrono::steady_clock::now() + std::chrono::duration_cast< std::chrono::nanoseconds >(xtimeout);
+        return wait_idle_until(&xtm_end);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回任务对象的优先级数量（参看 x_config_t::priorities）。
+     */
+    inline size_t priorities(void) const { return m_xpriorities; }
+
+    /**********************************************************/
+    /**
+     * @brief 返回指定优先级的队列中，等待执行的任务对象数量（近似值）。
+     */
+    inline size_t lane_size(size_t xpriority) const
+    {
+        if (0 != xpriority)
+        {
+            return (xpriority <= m_xlane_count) ? m_xlanes[xpriority - 1].m_xst_tasks.load() : 0;
+        }
+
+        size_t xst_lst_tasks  = m_xst_lst_tasks.load();
+        size_t xst_prio_tasks = m_xst_prio_tasks.load();
+        return (xst_lst_tasks > xst_prio_tasks) ? (xst_lst_tasks - xst_prio_tasks) : 0;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 清除任务队列中所有的任务对象。
+     */
+    void cleanup_task(void)
+    {
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        m_xst_get_task.fetch_add(1);
+
+        // 删除串行执行序列中等待放行的任务对象
+        cleanup_strands();
+
+        // 回收任务对象时，可能触发后续操作（x_future_t::then() 等）再加入任务队列，
+        // 因此反复清理，直至某一轮没有任务对象可回收
+        bool xcleaned = true;
+        while (xcleaned)
+        {
+            xcleaned = false;
+
+            // 先将各个工作线程本地队列、环形提交队列中的任务对象回收至任务队列
+            for (size_t xiter = 0, xcount = m_xworker_count.load(); xiter < xcount; ++xiter)
+            {
+                reclaim_worker_tasks(m_xworker_table[xiter].load());
+            }
+            reclaim_ring_tasks();
+
+            // 只扣减实际丢弃的数量：执行中的任务对象仍计入总数量，由其执行完成后自行递减
+            size_t xdropped = 0;
+
+            {
+                std::lock_guard< x_locker_t > xautolock_run(m_lock_run_task);
+
+                m_lst_smt_tasks.pop_all(m_lst_run_tasks);
+                reclaim_lane_tasks(m_lst_run_tasks);
+
+                while (!m_lst_run_tasks.empty())
+                {
+                    xtask_ptr = m_lst_run_tasks.pop_front();
+                    xcleaned  = true;
+                    xdropped += 1;
+
+                    // 丢弃的任务对象若属于某个串行执行序列，则同时释放该序列
+                    x_strand_t * xstrand_ptr = xtask_ptr->m_xstrand_ptr;
+
+                    release_capacity(xtask_ptr);
+                    recycle_task(xtask_ptr);
+
+                    if (nullptr != xstrand_ptr)
+                    {
+                        release_strand(xstrand_ptr);
+                    }
+                }
+            }
+
+            if (xdropped > 0)
+            {
+                m_xst_lst_tasks.fetch_sub(xdropped);
+                decrease_task_count(xdropped);
+            }
+
+            // 被丢弃的 schedule() 任务对象，解锁后才恢复其协程（协程可能再次提交任务对象）
+            if (resume_broken())
+                xcleaned = true;
+        }
+
+        m_xst_get_task.fetch_sub(1);
+    }
+
+    // internal invoking
+private:
+    /**********************************************************/
+    /**
+     * @brief 恢复当前线程此前丢弃的 schedule() 任务对象所对应的协程
+     *        （co_await 表达式抛出 std::future_errc::broken_promise 异常）。
+     * @note  须在释放线程池内部的锁之后调用。
+     * 
+     * @return bool
+     *         - 恢复了协程，返回 true；
+     *         - 没有待恢复的协程，返回 false。
+     */
+    static bool resume_broken(void)
+    {
+#if XTHREADPOOL_HAS_COROUTINE
+        std::vector< std::coroutine_handle<> > & xvec_broken = this_broken_resumes();
+        if (xvec_broken.empty())
+            return false;
+
+        // 协程恢复后可能再次丢弃任务对象（追加至线程本地的列表），因此先整体取走
+        std::vector< std::coroutine_handle<> > xvec_handles;
+        xvec_handles.swap(xvec_broken);
+        for (std::coroutine_handle<> & xhandle : xvec_handles)
+            xhandle.resume();
+        return true;
+#else // !XTHREADPOOL_HAS_COROUTINE
+        return false;
+#endif // XTHREADPOOL_HAS_COROUTINE
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 使用任务对象的删除器，对其进行资源回收操作。
+     */
+    static inline void recycle_task(x_task_ptr_t xtask_ptr)
+    {
+        x_task_group_t * xgroup_ptr = xtask_ptr->m_xgroup_ptr;
+
+        // 调用方已取走所属的串行执行序列（该序列随后可能被释放），所属的任务组也已在此取出；
+        // 删除器若复用该任务对象再次提交，不可残留指向它们的指针
+        xtask_ptr->m_xstrand_ptr = nullptr;
+        xtask_ptr->m_xgroup_ptr  = nullptr;
+
+        x_task_deleter_t * xdeleter_ptr = const_cast< x_task_deleter_t * >(xtask_ptr->get_deleter());
+        if (nullptr != xdeleter_ptr)
+        {
+            xdeleter_ptr->delete_task(xtask_ptr);
+        }
+
+        // 任务对象执行完成（或被丢弃）并回收后，才通知其所属的任务组
+        if (nullptr != xgroup_ptr)
+        {
+            xgroup_ptr->finish_task();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 等待任务对象总数量降为 0，直至超时（xtm_end 为 nullptr 时，不限时）。
+     * @note
+     * <pre>
+     *   等待方先读取 m_xidle_epoch，递增 m_xst_idle_waiters 后再检测任务数量；
+     *   完成方则在任务数量降为 0 后递增 m_xidle_epoch，再读取 m_xst_idle_waiters；
+     *   因此等待方要么看到任务数量为 0，要么在 futex 等待时看到 m_xidle_epoch 的变化或被唤醒。
+     * </pre>
+     */
+    bool wait_idle_until(const std::chrono::steady_clock::time_point * xtm_end)
+    {
+        while (m_xst_task_count.load() > 0)
+        {
+            std::chrono::nanoseconds xremain(-1);
+            if (nullptr != xtm_end)
+            {
+                xremain = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                *xtm_end - std::chrono::steady_clock::now());
+                if (xremain.count() <= 0)
+                    return false;
+            }
+
+            uint32_t xepoch = m_xidle_epoch.load();
+            m_xst_idle_waiters.fetch_add(1);
+            if (m_xst_task_count.load() > 0)
+            {
+                nsfutex::X_futex_wait(m_xidle_epoch, xepoch, xremain);
+            }
+            m_xst_idle_waiters.fetch_sub(1);
+        }
+
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将任务对象总数量递减 xcount，降为 0 时，唤醒 wait_idle() 的等待方。
+     */
+    inline void decrease_task_count(size_t xcount = 1)
+    {
+        if ((0 != xcount) && (xcount == m_xst_task_count.fetch_sub(xcount)))
+        {
+            notify_idle_waiters();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 任务对象总数量降为 0 时，唤醒 wait_idle() 的等待方（参看 wait_idle() 的说明）。
+     */
+    inline void notify_idle_waiters(void)
+    {
+        m_xidle_epoch.fetch_add(1);
+        if (m_xst_idle_waiters.load() > 0)
+        {
+            nsfutex::X_futex_wake_all(m_xidle_epoch);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 获取任务队列的任务数量。
+     */
+    inline size_t get_lst_task_size(void) const
+    {
+        return m_xst_lst_tasks;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 当前是否可提取待执行的任务对象。
+     */
+    inline bool is_enable_get_task(void) const
+    {
+        return (0 == m_xst_get_task.load());
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从任务队列中提取任务对象。
+     */
+    x_task_ptr_t get_task(void)
+    {
+        x_task_ptr_t xtask_ptr = nullptr;
+        if (!is_enable_get_task())
+        {
+            return nullptr;
+        }
+
+        // 优先从高优先级的车道中提取
+        if ((m_xst_prio_tasks.load() > 0) && (nullptr != (xtask_ptr = get_prio_task())))
+        {
+            return xtask_ptr;
+        }
+
+        return get_shared_task();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从（优先级为 0 的）环形提交队列与任务队列中提取任务对象。
+     */
+    x_task_ptr_t get_shared_task(void)
+    {
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        // 优先从（无锁的）环形提交队列中提取
+        if (m_xring && m_xring->pop(xtask_ptr))
+        {
+            m_xst_lst_tasks.fetch_sub(1);
+            xtask_ptr->set_running_flag(true);
+            return xtask_ptr;
+        }
+
+        std::lock_guard< x_locker_t > xautolock(m_lock_run_task);
+
+        // 将提交队列中的任务对象转移至待执行的任务队列（无需分配节点）
+        m_lst_smt_tasks.pop_all(m_lst_run_tasks);
+
+        xtask_ptr = pop_run_task(m_lst_run_tasks);
+        if (nullptr != xtask_ptr)
+        {
+            m_xst_lst_tasks.fetch_sub(1);
+            xtask_ptr->set_running_flag(true);
+        }
+
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 为工作线程（索引号小于 xthds 的）分配私有数据对象（已分配过的，不再重复分配）。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁。
+     */
+    void create_workers(size_t xthds)
+    {
+        if (!m_xworker_table)
+        {
+            m_xworker_table.reset(new std::atomic< x_worker_t * >[ECV_WORKERS_LIMIT]());
+        }
+
+        if (xthds > ECV_WORKERS_LIMIT)
+        {
+            xthds = ECV_WORKERS_LIMIT;
+        }
+
+        // NUMA 模式下，由工作线程在所属节点上自行分配（参看 create_numa_worker()）；
+        // 否则，一并补齐此前 NUMA 模式下尚未分配的
+        size_t xcount = m_xworker_count.load();
+        if (0 == m_xnuma_nodes)
+        {
+            for (size_t xiter = 0; xiter < xthds; ++xiter)
+            {
+                if (nullptr == m_xworker_table[xiter].load(std::memory_order_relaxed))
+                {
+                    m_xworker_table[xiter].store(new x_worker_t(this, xiter), std::memory_order_release);
+                }
+            }
+        }
+
+        if (xcount < xthds)
+        {
+            m_xworker_count.store(xthds, std::memory_order_release);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief NUMA 模式下，工作线程首次运行时，在所属节点上分配其私有数据对象
+     *        （当前线程已由 pin_worker() 限定在所属节点的逻辑 CPU 内，首次访问的内存页即分配自该节点）。
+     */
+    x_worker_t * create_numa_worker(size_t xthread_index)
+    {
+        if (xthread_index >= m_xworker_count.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        x_worker_t * xworker_ptr = m_xworker_table[xthread_index].load(std::memory_order_acquire);
+        if (nullptr == xworker_ptr)
+        {
+            xworker_ptr = new x_worker_t(this, xthread_index);
+            m_xworker_table[xthread_index].store(xworker_ptr, std::memory_order_release);
+        }
+
+        return xworker_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief NUMA 模式下，返回工作线程所属的节点。
+     */
+    inline size_t worker_node(size_t xthread_index) const
+    {
+        return (xthread_index % m_xnuma_nodes);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief NUMA 模式下，返回当前线程所在的节点（无法获取时，返回 m_xnuma_nodes）。
+     */
+    inline size_t current_node(void) const
+    {
+        int xcpu = nsaffinity::X_current_cpu();
+        if ((xcpu < 0) || (static_cast< size_t >(xcpu) >= m_vec_cpu_node.size()) || (m_vec_cpu_node[xcpu] < 0))
+            return m_xnuma_nodes;
+        return static_cast< size_t >(m_vec_cpu_node[xcpu]);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作窃取模式下，为外部线程提交的任务对象选取投递的工作线程：
+     *        NUMA 模式下，轮询选取提交方所在节点的工作线程，否则轮询选取所有的工作线程。
+     * 
+     * @return x_worker_t *
+     *         - 没有可投递的工作线程（或其私有数据尚未分配）时，返回 nullptr。
+     */
+    x_worker_t * select_inbox_worker(void)
+    {
+        size_t xcount = m_xworker_count.load(std::memory_order_acquire);
+        if (xcount > thds_target())
+            xcount = thds_target();
+        if (0 == xcount)
+        {
+            return nullptr;
+        }
+
+        size_t xindex = 0;
+        size_t xnode  = (m_xnuma_nodes > 0) ? current_node() : m_xnuma_nodes;
+        size_t xgroup = (xnode < m_xnuma_nodes) ? (xcount + m_xnuma_nodes - 1 - xnode) / m_xnuma_nodes : 0;
+        if (xgroup > 0)
+        {
+            xindex = xnode + m_xnuma_nodes * (m_xnode_rr[xnode].fetch_add(1, std::memory_order_relaxed) % xgroup);
+        }
+        else
+        {
+            xindex = m_xrr_index.fetch_add(1, std::memory_order_relaxed) % xcount;
+        }
+
+        return m_xworker_table[xindex].load(std::memory_order_acquire);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 获取工作线程的私有数据对象（不存在时，返回 nullptr）。
+     */
+    inline x_worker_t * get_worker(size_t xthread_index) const
+    {
+        if (xthread_index >= m_xworker_count.load(std::memory_order_acquire))
+            return nullptr;
+        return m_xworker_table[xthread_index].load(std::memory_order_acquire);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 按调度模式，将（已预留容量的）任务对象加入相应的队列。
+     */
+    void push_task(x_task_ptr_t xtask_ptr)
+    {
+        count_enqueue(xtask_ptr);
+
+        if (m_work_stealing)
+        {
+            submit_task_ws(xtask_ptr);
+        }
+        else if (m_xring)
+        {
+            submit_task_ring(xtask_ptr);
+        }
+        else
+        {
+            // 先递增计数，避免任务对象在被执行完成后才递增（计数值出现下溢）
+            m_xst_lst_tasks.fetch_add(1);
+            m_xst_task_count.fetch_add(1);
+
+            m_lst_smt_tasks.push(xtask_ptr);
+
+            notify_idle_worker();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 统计入队的任务对象（启用 x_config_t::timing_metrics 时，记录入队的时间点）。
+     */
+    inline void count_enqueue(x_task_ptr_t xtask_ptr)
+    {
+        m_xst_submitted.fetch_add(1, std::memory_order_relaxed);
+        if (m_xtiming || trace_enabled())
+        {
+            xtask_ptr->m_xtm_enqueue = steady_ns();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 是否正在记录追踪记录（未启用 XTHREADPOOL_ENABLE_TRACE 时，恒为 false）。
+     */
+    inline bool trace_enabled(void) const
+    {
+#if XTHREADPOOL_ENABLE_TRACE
+        return m_xtracing.load(std::memory_order_relaxed);
+#else // !XTHREADPOOL_ENABLE_TRACE
+        return false;
+#endif // XTHREADPOOL_ENABLE_TRACE
+    }
+
+#if XTHREADPOOL_ENABLE_TRACE
+    /**********************************************************/
+    /**
+     * @brief 将追踪记录写入工作线程的环形缓存（缓存尚未分配，或容量已改变时，重新分配）。
+     * 
+     * @param [in    ] xthread_index : 工作线程的索引号。
+     * @param [in,out] xring_ptr     : 工作线程所缓存的环形缓存指针。
+     * @param [in    ] xrecord       : 追踪记录。
+     */
+    void trace_record(size_t xthread_index, x_trace_ring_t *& xring_ptr, const x_trace_record_t & xrecord)
+    {
+        size_t xcapacity = m_xtrace_capacity.load(std::memory_order_relaxed);
+        if ((nullptr == xring_ptr) || (xring_ptr->capacity() != xcapacity))
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_metrics);
+
+            if (m_vec_trace_rings.size() <= xthread_index)
+                m_vec_trace_rings.resize(xthread_index + 1);
+
+            std::unique_ptr< x_trace_ring_t > & xring = m_vec_trace_rings[xthread_index];
+            if (!xring || (xring->capacity() != xcapacity))
+                xring.reset(new x_trace_ring_t(xcapacity));
+            xring_ptr = xring.get();
+        }
+
+        xring_ptr->push(xrecord);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将字符串转义为 JSON 字符串的内容（追加至 xstr_text）。
+     */
+    static void trace_escape(std::string & xstr_text, const char * xszt_text)
+    {
+        for (; '\0' != *xszt_text; ++xszt_text)
+        {
+            unsigned char xchar = static_cast< unsigned char >(*xszt_text);
+            if (('"' == xchar) || ('\\' == xchar))
+            {
+                xstr_text += '\\';
+                xstr_text += static_cast< char >(xchar);
+            }
+            else if (xchar < 0x20)
+            {
+                char xszt_code[8];
+                snprintf(xszt_code, sizeof(xszt_code), "\\u%04x", xchar);
+                xstr_text += xszt_code;
+            }
+            else
+            {
+                xstr_text += static_cast< char >(xchar);
+            }
+        }
+    }
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+    /**********************************************************/
+    /**
+     * @brief 将任务对象追加到（公共的）提交任务队列（不更新计数）。
+     */
+    inline void push_smt_task(x_task_ptr_t xtask_ptr)
+    {
+        m_lst_smt_tasks.push(xtask_ptr);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若存在空闲的工作线程，则唤醒其中一个（参看 x_idle_slot_t 的说明）。
+     * @note  没有空闲的工作线程时，只读取一次 m_xst_idle_thds，不加锁，也不进行系统调用。
+     */
+    inline void notify_idle_worker(void)
+    {
+        notify_parked();
+
+        if (m_xst_idle_thds.load() > 0)
+        {
+            wake_idle_workers(1);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若存在空闲的工作线程，则唤醒其中的 min(xst_count, 空闲数量) 个。
+     */
+    inline void notify_idle_workers(size_t xst_count)
+    {
+        notify_parked();
+
+        if (m_xst_idle_thds.load() > 0)
+        {
+            wake_idle_workers(xst_count);
+        }
+    }
+
+    // idle workers
+private:
+    /**
+     * @struct x_idle_slot_t
+     * @brief  空闲工作线程的等待槽位（位于工作线程的栈上，独占缓存行）。
+     * @note
+     * <pre>
+     *   任务队列为空时，工作线程将自身的槽位压入空闲栈（m_xidle_top，LIFO，
+     *   优先唤醒最近空闲、缓存仍然有效的工作线程），递增 m_xst_idle_thds 后，
+     *   再检测任务数量，然后以 futex 等待其槽位的 m_xsignal 被置位。
+     *   提交方则在任务数量递增之后读取 m_xst_idle_thds（二者均为 seq_cst 操作）：
+     *   要么等待方看到新的任务数量，要么提交方看到非 0 的空闲数量，
+     *   从空闲栈中弹出一个槽位，置位后只唤醒该槽位上的工作线程。
+     *   槽位一经弹出，即归唤醒方置位；等待方只有看到置位后才可离开（槽位随后可能失效）。
+     * </pre>
+     */
+    struct alignas(64) x_idle_slot_t
+    {
+        x_idle_slot_t(void)
+            : m_xsignal(0)
+            , m_xnext(nullptr)
+        {
+
+        }
+
+        std::atomic< uint32_t > m_xsignal;        ///< 被唤醒的标识（futex 等待的字）
+        x_idle_slot_t *         m_xnext;          ///< 空闲栈中的下一个槽位
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 从空闲栈中弹出至多 xcount 个槽位，并唤醒其工作线程。
+     */
+    void wake_idle_workers(size_t xcount)
+    {
+        x_idle_slot_t * xlist_ptr = nullptr;
+
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_idle);
+
+            while ((xcount > 0) && (nullptr != m_xidle_top))
+            {
+                x_idle_slot_t * xslot_ptr = m_xidle_top;
+                m_xidle_top = xslot_ptr->m_xnext;
+                xslot_ptr->m_xnext = xlist_ptr;
+                xlist_ptr = xslot_ptr;
+                m_xst_idle_thds.fetch_sub(1);
+                xcount -= 1;
+            }
+        }
+
+        while (nullptr != xlist_ptr)
+        {
+            // 置位后，槽位可能随即失效，因此先取出链接
+            x_idle_slot_t * xslot_ptr = xlist_ptr;
+            xlist_ptr = xslot_ptr->m_xnext;
+
+            xslot_ptr->m_xsignal.store(1, std::memory_order_release);
+            nsfutex::X_futex_wake_one(xslot_ptr->m_xsignal);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若槽位仍在空闲栈中，则将其移除。
+     * 
+     * @return bool
+     *         - 已移除，返回 true；
+     *         - 槽位已被唤醒方弹出，返回 false。
+     */
+    bool remove_idle_slot(x_idle_slot_t & xslot)
+    {
+        std::lock_guard< x_locker_t > xautolock(m_lock_idle);
+
+        for (x_idle_slot_t ** xlink_ptr = &m_xidle_top; nullptr != *xlink_ptr; xlink_ptr = &(*xlink_ptr)->m_xnext)
+        {
+            if (&xslot == *xlink_ptr)
+            {
+                *xlink_ptr = xslot.m_xnext;
+                m_xst_idle_thds.fetch_sub(1);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作线程等待任务对象（任务队列为空时），直至有任务对象或需要退出。
+     * 
+     * @return bool
+     *         - 被唤醒（或无需等待），返回 true；
+     *         - 弹性模式下，空闲超过 keep_alive 时长（槽位已移出空闲栈），返回 false。
+     */
+    bool wait_idle_slot(x_idle_slot_t & xslot)
+    {
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_idle);
+            xslot.m_xsignal.store(0, std::memory_order_relaxed);
+            xslot.m_xnext = m_xidle_top;
+            m_xidle_top   = &xslot;
+            m_xst_idle_thds.fetch_add(1);
+        }
+
+        if (((get_lst_task_size() > 0) || !is_enable_running() || has_excess_workers()) && remove_idle_slot(xslot))
+        {
+            return true;
+        }
+
+        bool xtimed = (m_xkeep_alive.count() > 0);
+        std::chrono::steady_clock::time_point xtm_end = std::chrono::steady_clock::now() + m_xkeep_alive;
+
+        x_worker_stats_t * xstats_ptr = this_stats();
+        bool               xparked    = false;
+
+        // 槽位已（或将要）被弹出，等待其置位
+        while (0 == xslot.m_xsignal.load(std::memory_order_acquire))
+        {
+            if (!xparked && (nullptr != xstats_ptr))
+            {
+                x_worker_stats_t::add(xstats_ptr->m_xst_parks);
+                xparked = true;
+            }
+
+            if (!xtimed)
+            {
+                nsfutex::X_futex_wait(xslot.m_xsignal, 0);
+                continue;
+            }
+
+            std::chrono::nanoseconds xremain = std::chrono::duration_cast< std::chrono::nanoseconds >(
+                                                    xtm_end - std::chrono::steady_clock::now());
+            if (xremain.count() <= 0)
+            {
+                if (remove_idle_slot(xslot))
+                    return false;
+
+                // 已被唤醒方弹出，置位随即到来
+                xtimed = false;
+                continue;
+            }
+
+            nsfutex::X_futex_wait(xslot.m_xsignal, 0, xremain);
+        }
+
+        if (xparked)
+        {
+            x_worker_stats_t::add(xstats_ptr->m_xst_wakeups);
+        }
+
+        return true;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 提交一批已链接好的任务对象（参看 submit_tasks() 接口）。
+     */
+    void submit_task_list(x_task_list_t & xlst_tasks)
+    {
+        size_t xst_count = xlst_tasks.size();
+
+        m_xst_submitted.fetch_add(xst_count, std::memory_order_relaxed);
+        if (m_xtiming || trace_enabled())
+        {
+            uint64_t xtm_now = steady_ns();
+            for (x_task_ptr_t xiter_ptr = xlst_tasks.front(); nullptr != xiter_ptr; xiter_ptr = x_task_list_t::next(xiter_ptr))
+                xiter_ptr->m_xtm_enqueue = xtm_now;
+        }
+
+        // 先递增计数，避免任务对象在被执行完成后才递增（计数值出现下溢）
+        m_xst_lst_tasks.fetch_add(xst_count);
+        m_xst_task_count.fetch_add(xst_count);
+
+        x_worker_t * xworker_ptr = this_worker();
+        if ((nullptr == xworker_ptr) || (this != xworker_ptr->m_xowner_ptr) || !m_work_stealing)
+        {
+            xworker_ptr = nullptr;
+        }
+
+        if (nullptr != xworker_ptr)
+        {
+            // 工作窃取模式下，工作线程提交的任务对象，压入其本地队列
+            // 注意：必须先从链表中摘除，再入队（入队后，可能立即被其他线程提取执行）
+            while (!xlst_tasks.empty())
+            {
+                x_task_ptr_t xtask_ptr = xlst_tasks.pop_front();
+                if (!xworker_ptr->m_xdeque.push(xtask_ptr))
+                {
+                    xlst_tasks.push_front(xtask_ptr);
+                    break;
+                }
+            }
+        }
+        else if (m_xring)
+        {
+            while (!xlst_tasks.empty())
+            {
+                x_task_ptr_t xtask_ptr = xlst_tasks.pop_front();
+                if (!m_xring->push(std::move(xtask_ptr)))
+                {
+                    xlst_tasks.push_front(xtask_ptr);
+                    break;
+                }
+            }
+        }
+        else if (m_work_stealing)
+        {
+            // 工作窃取模式下，外部线程提交的任务对象，均分投递至各个工作线程
+            // （NUMA 模式下，只投递至提交方所在节点的工作线程）
+            size_t xcount = m_xworker_count.load(std::memory_order_acquire);
+            if (xcount > thds_target())
+                xcount = thds_target();
+            if ((m_xnuma_nodes > 0) && (xcount > 0))
+                xcount = (xcount + m_xnuma_nodes - 1) / m_xnuma_nodes;
+
+            size_t xparts = (xcount < xst_count) ? xcount : xst_count;
+            for (size_t xiter = 0; xiter < xparts; ++xiter)
+            {
+                x_task_list_t xlst_part;
+                for (size_t xsize = xst_count / xparts + ((xiter < (xst_count % xparts)) ? 1 : 0); xsize > 0; --xsize)
+                {
+                    xlst_part.push_back(xlst_tasks.pop_front());
+                }
+
+                xworker_ptr = select_inbox_worker();
+                if (nullptr == xworker_ptr)
+                {
+                    xlst_tasks.splice_back(xlst_part);
+                    continue;
+                }
+
+                std::lock_guard< x_locker_t > xautolock(xworker_ptr->m_lock_inbox);
+                xworker_ptr->m_xst_inbox.fetch_add(xlst_part.size());
+                xworker_ptr->m_lst_inbox.splice_back(xlst_part);
+            }
+        }
+
+        // 剩余的任务对象，一次性加入提交队列
+        m_lst_smt_tasks.push(xlst_tasks);
+
+        notify_idle_workers(xst_count);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将任务对象提交至环形提交队列（队列已满时，转入公共的任务队列）。
+     */
+    void submit_task_ring(x_task_ptr_t xtask_ptr)
+    {
+        // 先递增计数，避免任务对象在被执行完成后才递增（计数值出现下溢）
+        m_xst_lst_tasks.fetch_add(1);
+        m_xst_task_count.fetch_add(1);
+
+        if (!m_xring->push(std::move(xtask_ptr)))
+        {
+            push_smt_task(xtask_ptr);
+        }
+
+        notify_idle_worker();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将环形提交队列中的任务对象，回收至公共的任务队列。
+     */
+    void reclaim_ring_tasks(void)
+    {
+        if (!m_xring)
+        {
+            return;
+        }
+
+        x_task_ptr_t xtask_ptr = nullptr;
+        while (m_xring->pop(xtask_ptr))
+        {
+            push_smt_task(xtask_ptr);
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作窃取模式下，提交任务对象。
+     * @note
+     * <pre>
+     *   工作线程提交的任务对象，压入其本地队列（队列已满时，转入公共的任务队列）；
+     *   外部线程提交的任务对象，若启用了环形提交队列，则投递至该队列，
+     *   否则轮询投递至各个工作线程的 m_lst_inbox 中。
+     * </pre>
+     */
+    void submit_task_ws(x_task_ptr_t xtask_ptr)
+    {
+        x_worker_t * xworker_ptr = this_worker();
+        if (((nullptr == xworker_ptr) || (this != xworker_ptr->m_xowner_ptr)) && m_xring)
+        {
+            submit_task_ring(xtask_ptr);
+            return;
+        }
+
+        // 先递增计数，避免任务对象在被执行完成后才递增（计数值出现下溢）
+        m_xst_lst_tasks.fetch_add(1);
+        m_xst_task_count.fetch_add(1);
+
+        if ((nullptr != xworker_ptr) && (this == xworker_ptr->m_xowner_ptr))
+        {
+            if (!xworker_ptr->m_xdeque.push(xtask_ptr))
+            {
+                push_smt_task(xtask_ptr);
+            }
+        }
+        else
+        {
+            xworker_ptr = select_inbox_worker();
+            if (nullptr != xworker_ptr)
+            {
+                std::lock_guard< x_locker_t > xautolock(xworker_ptr->m_lock_inbox);
+                xworker_ptr->m_lst_inbox.push_back(xtask_ptr);
+                xworker_ptr->m_xst_inbox.fetch_add(1);
+            }
+            else
+            {
+                push_smt_task(xtask_ptr);
+            }
+        }
+
+        notify_idle_worker();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从工作线程的 m_lst_inbox 中提取任务对象。
+     * 
+     * @param [in ] xworker_ptr : 工作线程的私有数据对象。
+     * @param [in ] xis_owner   : 调用方是否为 xworker_ptr 所属的工作线程；
+     *                            若是，则同时将剩余的任务对象转入其本地队列，以便其他工作线程窃取。
+     */
+    x_task_ptr_t pop_inbox_task(x_worker_t * xworker_ptr, bool xis_owner)
+    {
+        if (xworker_ptr->m_xst_inbox.load(std::memory_order_relaxed) <= 0)
+        {
+            return nullptr;
+        }
+
+        std::lock_guard< x_locker_t > xautolock(xworker_ptr->m_lock_inbox);
+        if (xworker_ptr->m_lst_inbox.empty())
+        {
+            return nullptr;
+        }
+
+        x_task_ptr_t xtask_ptr = xworker_ptr->m_lst_inbox.pop_front();
+        xworker_ptr->m_xst_inbox.fetch_sub(1);
+
+        if (xis_owner)
+        {
+            // 注意：必须先从链表中摘除，再压入本地队列（压入后，可能立即被其他线程窃取执行）
+            while (!xworker_ptr->m_lst_inbox.empty())
+            {
+                x_task_ptr_t xiter_ptr = xworker_ptr->m_lst_inbox.pop_front();
+                if (!xworker_ptr->m_xdeque.push(xiter_ptr))
+                {
+                    xworker_ptr->m_lst_inbox.push_front(xiter_ptr);
+                    break;
+                }
+
+                xworker_ptr->m_xst_inbox.fetch_sub(1);
+            }
+        }
+
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 从随机选取的其他工作线程中窃取任务对象。
+     */
+    x_task_ptr_t steal_task(x_worker_t * xworker_ptr)
+    {
+        size_t xcount = m_xworker_count.load(std::memory_order_acquire);
+        if (xcount <= 1)
+        {
+            return nullptr;
+        }
+
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        // NUMA 模式下，先窃取同一节点的工作线程，再跨节点窃取
+        if (m_xnuma_nodes > 1)
+        {
+            size_t xnode  = worker_node(xworker_ptr->m_xthread_index);
+            size_t xgroup = (xcount + m_xnuma_nodes - 1 - xnode) / m_xnuma_nodes;
+            size_t xfirst = (xgroup > 0) ? (xworker_ptr->next_random() % xgroup) : 0;
+
+            for (size_t xiter = 0; (xiter < xgroup) && (nullptr == xtask_ptr); ++xiter)
+            {
+                x_worker_t * xvictim_ptr = m_xworker_table[xnode + m_xnuma_nodes * ((xfirst + xiter) % xgroup)].load(
+                                                std::memory_order_acquire);
+                if ((nullptr == xvictim_ptr) || (xworker_ptr == xvictim_ptr))
+                {
+                    continue;
+                }
+
+                xtask_ptr = xvictim_ptr->m_xdeque.steal();
+                if (nullptr == xtask_ptr)
+                {
+                    xtask_ptr = pop_inbox_task(xvictim_ptr, false);
+                }
+            }
+
+            if (nullptr != xtask_ptr)
+            {
+                return xtask_ptr;
+            }
+        }
+
+        size_t xstart = xworker_ptr->next_random() % xcount;
+
+        for (size_t xiter = 0; (xiter < xcount) && (nullptr == xtask_ptr); ++xiter)
+        {
+            x_worker_t * xvictim_ptr = m_xworker_table[(xstart + xiter) % xcount].load(std::memory_order_acquire);
+            if ((nullptr == xvictim_ptr) || (xworker_ptr == xvictim_ptr))
+            {
+                continue;
+            }
+
+            xtask_ptr = xvictim_ptr->m_xdeque.steal();
+            if (nullptr == xtask_ptr)
+            {
+                xtask_ptr = pop_inbox_task(xvictim_ptr, false);
+            }
+        }
+
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作窃取模式下，提取任务对象。
+     * @note
+     * <pre>
+     *   提取次序为：高优先级的车道 -> 本地队列 -> 本地的 m_lst_inbox -> 环形提交队列 ->
+     *   窃取其他工作线程 -> 公共的任务队列（参看 get_shared_task()）。
+     * </pre>
+     */
+    x_task_ptr_t get_task(x_worker_t * xworker_ptr)
+    {
+        if (!is_enable_get_task())
+        {
+            return nullptr;
+        }
+
+        // 高优先级车道中的任务对象，优先于本地队列
+        x_task_ptr_t xtask_ptr = nullptr;
+        if ((m_xst_prio_tasks.load() > 0) && (nullptr != (xtask_ptr = get_prio_task())))
+            return xtask_ptr;
+
+        xtask_ptr = xworker_ptr->m_xdeque.pop();
+        if (nullptr == xtask_ptr)
+            xtask_ptr = pop_inbox_task(xworker_ptr, true);
+        if ((nullptr == xtask_ptr) && m_xring)
+            m_xring->pop(xtask_ptr);
+        if ((nullptr == xtask_ptr) && (nullptr != (xtask_ptr = steal_task(xworker_ptr))) && (nullptr != this_stats()))
+            x_worker_stats_t::add(this_stats()->m_xst_steals);
+        if (nullptr == xtask_ptr)
+            return get_shared_task();
+
+        m_xst_lst_tasks.fetch_sub(1);
+        xtask_ptr->set_running_flag(true);
+
+        return xtask_ptr;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 将工作线程本地队列与 m_lst_inbox 中的任务对象，回收至公共的任务队列。
+     * @note  工作线程退出时，或 没有工作线程运行时，才可调用该接口。
+     */
+    void reclaim_worker_tasks(x_worker_t * xworker_ptr)
+    {
+        if (nullptr == xworker_ptr)
+        {
+            return;
+        }
+
+        x_task_list_t xlst_tasks;
+
+        x_task_ptr_t xtask_ptr = nullptr;
+        while (nullptr != (xtask_ptr = xworker_ptr->m_xdeque.steal()))
+        {
+            xlst_tasks.push_back(xtask_ptr);
+        }
+
+        {
+            std::lock_guard< x_locker_t > xautolock(xworker_ptr->m_lock_inbox);
+            xlst_tasks.splice_back(xworker_ptr->m_lst_inbox);
+            xworker_ptr->m_xst_inbox.store(0);
+        }
+
+        m_lst_smt_tasks.push(xlst_tasks);
+    }
+
+    // worker threads
+private:
+    /**********************************************************/
+    /**
+     * @brief m_xthds_state 的组成：高 32 位为目标数量，低 32 位为运行中（未认领退出）的工作线程数量。
+     */
+    static inline uint64_t make_thds_state(size_t xtarget, size_t xlive)
+    {
+        return ((static_cast< uint64_t >(xtarget) << 32) | static_cast< uint64_t >(xlive));
+    }
+
+    static inline size_t thds_target(uint64_t xstate) { return static_cast< size_t >(xstate >> 32); }
+    static inline size_t thds_live(uint64_t xstate) { return static_cast< size_t >(xstate & 0xFFFFFFFFULL); }
+
+    /**********************************************************/
+    /**
+     * @brief 返回工作线程的目标数量。
+     */
+    inline size_t thds_target(void) const
+    {
+        return thds_target(m_xthds_state.load(std::memory_order_relaxed));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 判断运行中的工作线程数量是否超过目标数量（即 有工作线程需要退出）。
+     */
+    inline bool has_excess_workers(void) const
+    {
+        uint64_t xstate = m_xthds_state.load();
+        return (thds_live(xstate) > thds_target(xstate));
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作线程在任务对象之间调用：若运行中的工作线程数量超过目标数量，则认领退出。
+     * 
+     * @return bool
+     *         - 认领成功（调用方随即退出），返回 true；
+     *         - 无需退出，返回 false。
+     */
+    bool try_retire(void)
+    {
+        uint64_t xstate = m_xthds_state.load(std::memory_order_relaxed);
+        while (thds_live(xstate) > thds_target(xstate))
+        {
+            // 目标数量与运行数量位于同一原子字中，与 resize() 的更新不会交错
+            if (m_xthds_state.compare_exchange_weak(xstate, xstate - 1))
+                return true;
+        }
+
+        return false;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 调整工作线程数量（参看 resize() 的说明）。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁。
+     */
+    void resize_workers(size_t xthds)
+    {
+        if (0 == xthds)
+        {
+            stop_workers();
+            return;
+        }
+
+        m_enable_running.store(true, std::memory_order_release);
+
+        // 回收已退出的工作线程，其槽位可供新增的工作线程复用
+        join_exited_threads(false);
+
+        // 更新目标数量；运行中的工作线程数量不足时，由本次操作补足
+        uint64_t xstate = m_xthds_state.load();
+        while (!m_xthds_state.compare_exchange_weak(
+                    xstate, make_thds_state(xthds, (thds_live(xstate) < xthds) ? xthds : thds_live(xstate))))
+        {
+        }
+
+        size_t xlive = thds_live(xstate);
+        if (xthds > xlive)
+        {
+            spawn_workers(xthds - xlive);
+        }
+        else if (xlive > xthds)
+        {
+            // 唤醒空闲的工作线程，使其退出；不足的部分由执行中的工作线程在任务对象之间退出
+            wake_idle_workers(xlive - xthds);
+            m_xpark_epoch.fetch_add(1);
+            nsfutex::X_futex_wake_all(m_xpark_epoch);
+        }
+
+        // 被本次操作取代的（目标数量更小的）resize_async() 请求，视为已完成
+        complete_resize_states(xthds);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 弹性模式下，空闲超时的工作线程调用：在不低于 min_threads 的前提下认领退出
+     *        （同时递减目标数量；有待生效的减少操作时，按 try_retire() 认领）。
+     * 
+     * @return bool
+     *         - 认领成功（调用方随即退出），返回 true；
+     *         - 已达到下限数量，返回 false。
+     */
+    bool try_reap(void)
+    {
+        uint64_t xstate = m_xthds_state.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            size_t   xlive   = thds_live(xstate);
+            size_t   xtarget = thds_target(xstate);
+            uint64_t xnewst  = 0;
+
+            if (xlive > xtarget)
+                xnewst = xstate - 1;
+            else if (xlive > m_xmin_thds)
+                xnewst = make_thds_state(xtarget - 1, xlive - 1);
+            else
+                return false;
+
+            if (m_xthds_state.compare_exchange_weak(xstate, xnewst))
+                return true;
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 弹性模式的控制线程：每个检测周期采样任务队列的深度与执行完成的任务对象数量，
+     *        没有空闲的工作线程，且 队列深度 或 估算的排队时长（深度 / 周期内的完成速率）
+     *        连续 ECV_SCALE_UP_TICKS 个周期不小于阈值时，增加工作线程（至多 max_threads）。
+     * @note  只在控制线程中调用 resize()，提交操作不受影响。
+     */
+    void scaler_run(void)
+    {
+        uint64_t xst_done = 0;
+        size_t   xst_hot  = 0;
+
+        {
+            std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
+            xst_done = done_count();
+        }
+
+        while (0 == m_xscaler_stop.load())
+        {
+            nsfutex::X_futex_wait(m_xscaler_stop, 0, m_xscale_interval);
+            if (0 != m_xscaler_stop.load())
+            {
+                break;
+            }
+
+            std::lock_guard< x_locker_t > xautolock_thds(m_lock_thread);
+
+            uint64_t xdone  = done_count();
+            uint64_t xdelta = xdone - xst_done;
+            xst_done = xdone;
+
+            size_t xdepth = get_lst_task_size();
+            bool   xhot   = false;
+            if ((xdepth > 0) && (0 == idle_count()))
+            {
+                if ((0 != m_xscale_depth) && (xdepth >= m_xscale_depth))
+                {
+                    xhot = true;
+                }
+                else if (m_xscale_sojourn.count() > 0)
+                {
+                    // 排队时长的估算值（利特尔法则）：周期内没有完成任何任务对象时，视为无穷大
+                    xhot = (0 == xdelta) ||
+                           (std::chrono::duration_cast< std::chrono::nanoseconds >(m_xscale_interval).count() /
+                            static_cast< double >(xdelta) * xdepth >=
+                            std::chrono::duration_cast< std::chrono::nanoseconds >(m_xscale_sojourn).count());
+                }
+            }
+
+            xst_hot = xhot ? (xst_hot + 1) : 0;
+            if ((xst_hot < ECV_SCALE_UP_TICKS) || !is_enable_running())
+            {
+                continue;
+            }
+
+            xst_hot = 0;
+
+            // 每次增加 当前数量 的 1/4（至少 1 个）
+            uint64_t xstate = m_xthds_state.load();
+            size_t   xthds  = (thds_live(xstate) > thds_target(xstate)) ? thds_live(xstate) : thds_target(xstate);
+            if (xthds < m_xmax_thds)
+            {
+                xthds += (xthds >= 8) ? (xthds / 4) : 1;
+                resize_workers((xthds < m_xmax_thds) ? xthds : m_xmax_thds);
+            }
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 停止弹性模式的控制线程（若已启动）。
+     */
+    void stop_scaler(void)
+    {
+        if (m_xscaler.joinable())
+        {
+            m_xscaler_stop.store(1);
+            nsfutex::X_futex_wake_all(m_xscaler_stop);
+            m_xscaler.join();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 返回各个槽位上执行完成的任务对象数量之和。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁。
+     */
+    uint64_t done_count(void) const
+    {
+        uint64_t xcount = 0;
+        for (const x_thread_slot_t & xslot : m_lst_threads)
+        {
+            xcount += xslot.m_xstats.m_xst_tasks.load(std::memory_order_relaxed);
+        }
+
+        return xcount;
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 创建 xcount 个工作线程（优先复用空的槽位，线程索引号尽量紧凑）。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁；m_xthds_state 中的运行数量已预先计入。
+     */
+    void spawn_workers(size_t xcount)
+    {
+        try
+        {
+            std::list< x_thread_slot_t >::iterator xiter = m_lst_threads.begin();
+            while (xcount > 0)
+            {
+                while ((xiter != m_lst_threads.end()) && xiter->m_xthread.joinable())
+                    ++xiter;
+                if (xiter == m_lst_threads.end())
+                {
+                    std::lock_guard< x_locker_t > xautolock(m_lock_metrics);
+                    xiter = m_lst_threads.emplace(xiter, m_lst_threads.size());
+                }
+
+                x_thread_slot_t & xslot = *xiter;
+
+                // 工作窃取模式下，为新增的工作线程分配私有数据
+                if (m_work_stealing)
+                {
+                    create_workers(xslot.m_xthread_index + 1);
+                }
+
+                {
+                    std::lock_guard< x_locker_t > xautolock(m_lock_retire);
+                    m_xst_threads += 1;
+                }
+
+                xslot.m_xexited.store(false);
+                xslot.m_xcpu.store(-1);
+                try
+                {
+                    xslot.m_xthread = std::thread([this, &xslot](void) -> void { thread_run(xslot); });
+                }
+                catch (...)
+                {
+                    std::lock_guard< x_locker_t > xautolock(m_lock_retire);
+                    m_xst_threads -= 1;
+                    throw;
+                }
+
+                xcount -= 1;
+            }
+        }
+        catch (...)
+        {
+            // 未能创建的工作线程，不再计入运行数量
+            m_xthds_state.fetch_sub(xcount);
+            throw;
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 由工作线程在执行任何任务对象之前调用：按亲和性策略绑定当前线程，并记录其绑定的逻辑 CPU 编号。
+     * @note  绑定失败时（如 CPU 编号不在进程的 cpuset 内），工作线程保持不绑定的状态。
+     */
+    void pin_worker(x_thread_slot_t & xslot)
+    {
+        int xcpu = -1;
+
+        if (m_xnuma_nodes > 0)
+        {
+            nsaffinity::X_pin_current(m_vec_numa_cpus[worker_node(xslot.m_xthread_index)]);
+        }
+        else if (ECV_AFFINITY_CPUSET == m_xaffinity_policy)
+        {
+            nsaffinity::X_pin_current(m_vec_affinity);
+        }
+        else if (ECV_AFFINITY_NONE != m_xaffinity_policy)
+        {
+            int xplan = m_vec_affinity[xslot.m_xthread_index % m_vec_affinity.size()];
+            if (nsaffinity::X_pin_current(std::vector< int >(1, xplan)))
+                xcpu = xplan;
+        }
+
+        xslot.m_xcpu.store(xcpu, std::memory_order_relaxed);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief join 已退出的工作线程（xall 为 true 时，join 所有的工作线程）。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁。
+     */
+    void join_exited_threads(bool xall)
+    {
+        for (x_thread_slot_t & xslot : m_lst_threads)
+        {
+            if (xslot.m_xthread.joinable() && (xall || xslot.m_xexited.load(std::memory_order_acquire)))
+            {
+                xslot.m_xthread.join();
+            }
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 通知所有工作线程退出，并等待其全部结束（resize(0)）。
+     * @note  调用该接口时，需要持有 m_lock_thread 锁。
+     */
+    void stop_workers(void)
+    {
+        m_enable_running.store(false, std::memory_order_release);
+
+        uint64_t xstate = m_xthds_state.load();
+        while (!m_xthds_state.compare_exchange_weak(xstate, make_thds_state(0, thds_live(xstate))))
+        {
+        }
+
+        wake_idle_workers(~static_cast< size_t >(0));
+        m_xpark_epoch.fetch_add(1);
+        nsfutex::X_futex_wake_all(m_xpark_epoch);
+
+        join_exited_threads(true);
+
+        {
+            // 移除槽位前，保留其统计值
+            std::lock_guard< x_locker_t > xautolock(m_lock_metrics);
+            for (const x_thread_slot_t & xslot : m_lst_threads)
+            {
+                xslot.m_xstats.collect(m_xretired_metrics);
+            }
+            m_lst_threads.clear();
+        }
+        m_xthds_state.store(0);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 完成 resize_async() 的请求：目标数量小于 xthds 的（被取代的），
+     *        或 尚未退出的工作线程数量已不超过其目标数量的。
+     */
+    void complete_resize_states(size_t xthds)
+    {
+        std::vector< x_resize_state_t * > xvec_ready;
+
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_retire);
+            for (size_t xiter = 0; xiter < m_vec_resizes.size(); )
+            {
+                x_resize_state_t * xstate_ptr = m_vec_resizes[xiter];
+                if ((xstate_ptr->m_xthds < xthds) || (m_xst_threads <= xstate_ptr->m_xthds))
+                {
+                    xvec_ready.push_back(xstate_ptr);
+                    m_vec_resizes[xiter] = m_vec_resizes.back();
+                    m_vec_resizes.pop_back();
+                }
+                else
+                {
+                    ++xiter;
+                }
+            }
+        }
+
+        // 在锁外完成（后续操作可能再次调用 resize_async()）
+        for (x_resize_state_t * xstate_ptr : xvec_ready)
+        {
+            xstate_ptr->set_ready(x_result_base_t::ECV_VALUE);
+            xstate_ptr->release();
+        }
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作线程退出时调用：递减尚未退出的工作线程数量，并完成已满足的 resize_async() 请求。
+     */
+    void on_worker_exit(void)
+    {
+        {
+            std::lock_guard< x_locker_t > xautolock(m_lock_retire);
+            m_xst_threads -= 1;
+        }
+
+        complete_resize_states(0);
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 自旋等待时，提示 CPU 当前处于自旋状态（x86 的 pause 指令、ARM 的 yield 指令）。
+     */
+    static inline void cpu_relax(void)
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM) || defined(_M_ARM64))
+        __yield();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+        __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__aarch64__) || defined(__arm__))
+        __asm__ __volatile__("yield" ::: "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 若存在挂起等待的工作线程（参看 x_idle_backoff_t），则将其全部唤醒。
+     * @note
+     * <pre>
+     *   调用方在此之前已修改了任务队列或任务对象的运行标识，且其间有 seq_cst 的读-改-写操作
+     *   （提交时的入队操作、finish_task() 内的计数操作），保证 m_xst_parked 的读取不会提前。
+     * </pre>
+     */
+    inline void notify_parked(void)
+    {
+        if (m_xst_parked.load() > 0)
+        {
+            m_xpark_epoch.fetch_add(1);
+            nsfutex::X_futex_wake_all(m_xpark_epoch);
+        }
+    }
+
+    /**
+     * @class x_idle_backoff_t
+     * @brief 工作线程提取不到可执行的任务对象（而任务队列非空）时的退避操作（参看 x_idle_policy_t）。
+     * @note
+     * <pre>
+     *   每次调用 idle() 执行一步退避操作，调用方随后重新尝试提取任务对象：
+     *   1. 自旋：每一步执行 ECV_SPIN_PAUSES 次 cpu_relax()，至多 m_xspin_limit 步；
+     *   2. 让出时间片：至多 ECV_YIELDS 步；
+     *   3. 挂起等待：先登记（递增 m_xst_parked、读取 m_xpark_epoch），调用方再尝试提取一次，
+     *      仍失败时，才以 futex 等待 m_xpark_epoch 变化。notify_parked() 先修改状态、再读取 m_xst_parked，
+     *      因此登记之后的提取操作要么看到新的状态，要么等待时被唤醒（或看到 m_xpark_epoch 已变化）。
+     *      等待设有 ECV_PARK_TIMEOUT 毫秒的超时，兜底任务对象的挂起状态由外部改变的情况。
+     *   自旋步数的上限按命中情况自适应：自旋阶段即提取到任务对象的，上限加倍；
+     *   让出时间片或挂起等待后才提取到的，上限减半。
+     * </pre>
+     */
+    class x_idle_backoff_t
+    {
+        // common data types
+    private:
+        enum
+        {
+            ECV_SPIN_PAUSES  = 32,    ///< 每一步自旋执行 cpu_relax() 的次数
+            ECV_SPIN_MIN     = 2,     ///< 自旋步数上限的最小值
+            ECV_SPIN_INIT    = 16,    ///< 自旋步数上限的初始值
+            ECV_SPIN_MAX     = 256,   ///< 自旋步数上限的最大值
+            ECV_YIELDS       = 16,    ///< 挂起等待之前，让出时间片的步数
+            ECV_PARK_TIMEOUT = 1,     ///< 挂起等待的超时时间（毫秒）
+        };
+
+        // constructor/destructor
+    public:
+        x_idle_backoff_t(x_threadpool_t & xpool, x_idle_policy_t xpolicy)
+            : m_xpool(xpool)
+            , m_xpolicy(xpolicy)
+            , m_xspin_limit((ECV_IDLE_SPIN == xpolicy) ? ECV_SPIN_MAX : ECV_SPIN_INIT)
+            , m_xspins(0)
+            , m_xyields(0)
+            , m_xparks(0)
+            , m_xarmed(false)
+            , m_xkey(0)
+        {
+
+        }
+
+        ~x_idle_backoff_t(void)
+        {
+            disarm();
+        }
+
+        x_idle_backoff_t(const x_idle_backoff_t & xobject) = delete;
+        x_idle_backoff_t & operator=(const x_idle_backoff_t & xobject) = delete;
+
+        // public interfaces
+    public:
+        /**********************************************************/
+        /**
+         * @brief 执行一步退避操作。
+         */
+        void idle(void)
+        {
+            if (ECV_IDLE_YIELD == m_xpolicy)
+            {
+                if (m_xyields++ < ECV_YIELDS)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    m_xyields = 0;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                return;
+            }
+
+            if (m_xarmed)
+            {
+                nsfutex::X_futex_wait(m_xpool.m_xpark_epoch, m_xkey, std::chrono::milliseconds(ECV_PARK_TIMEOUT));
+                disarm();
+                m_xparks += 1;
+                if (nullptr != this_stats())
+                    x_worker_stats_t::add(this_stats()->m_xst_parks);
+                return;
+            }
+
+            if (ECV_IDLE_PARK != m_xpolicy)
+            {
+                if (m_xspins < m_xspin_limit)
+                {
+                    m_xspins += 1;
+                    for (size_t xiter = 0; xiter < ECV_SPIN_PAUSES; ++xiter)
+                        cpu_relax();
+                    return;
+                }
+
+                if ((ECV_IDLE_SPIN == m_xpolicy) || (m_xyields < ECV_YIELDS))
+                {
+                    m_xyields += 1;
+                    std::this_thread::yield();
+                    return;
+                }
+            }
+
+            // 登记挂起等待，调用方再尝试提取一次任务对象
+            m_xpool.m_xst_parked.fetch_add(1);
+            m_xkey   = m_xpool.m_xpark_epoch.load();
+            m_xarmed = true;
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 提取到任务对象后，按本轮退避的情况调整自旋步数的上限，并重置状态。
+         */
+        inline void found(void)
+        {
+            if (0 == (m_xspins | m_xyields | m_xparks) && !m_xarmed)
+                return;
+
+            if (ECV_IDLE_ADAPTIVE == m_xpolicy)
+            {
+                if ((0 == m_xyields) && (0 == m_xparks) && !m_xarmed)
+                    m_xspin_limit = (m_xspin_limit * 2 < ECV_SPIN_MAX) ? (m_xspin_limit * 2) : static_cast< size_t >(ECV_SPIN_MAX);
+                else
+                    m_xspin_limit = (m_xspin_limit / 2 > ECV_SPIN_MIN) ? (m_xspin_limit / 2) : static_cast< size_t >(ECV_SPIN_MIN);
+            }
+
+            reset();
+        }
+
+        /**********************************************************/
+        /**
+         * @brief 重置状态（不调整自旋步数的上限；如任务队列已空时）。
+         */
+        inline void reset(void)
+        {
+            disarm();
+            m_xspins  = 0;
+            m_xyields = 0;
+            m_xparks  = 0;
+        }
+
+        // internal invoking
+    private:
+        /**********************************************************/
+        /**
+         * @brief 撤销挂起等待的登记。
+         */
+        inline void disarm(void)
+        {
+            if (m_xarmed)
+            {
+                m_xpool.m_xst_parked.fetch_sub(1);
+                m_xarmed = false;
+            }
+        }
+
+        // data members
+    private:
+        x_threadpool_t & m_xpool;        ///< 所属的线程池
+        x_idle_policy_t  m_xpolicy;      ///< 退避策略
+        size_t           m_xspin_limit;  ///< 自旋步数的上限
+        size_t           m_xspins;       ///< 本轮退避已自旋的步数
+        size_t           m_xyields;      ///< 本轮退避已让出时间片的步数
+        size_t           m_xparks;       ///< 本轮退避已挂起等待的次数
+        bool             m_xarmed;       ///< 是否已登记挂起等待
+        uint32_t         m_xkey;         ///< 登记时读取的 m_xpark_epoch 值
+    };
+
+    /**********************************************************/
+    /**
+     * @brief 任务对象执行完成后的收尾操作：重置运行标识、回收任务对象、
+     *        放行所属串行执行序列的下一个任务对象、归还容量。
+     */
+    void finish_task(x_task_ptr_t xtask_ptr)
+    {
+        if (m_check_suspened)
+        {
+            // 执行完任务对象后，将任务对象转换为 非挂起状态，
+            // 加锁进行操作，是为了与 get_task() 内的操作保持队列的同步
+
+            // 标识当前不可提取待执行的任务对象，迫使 get_task() 内部迅速解锁
+            m_xst_get_task.fetch_add(1);
+
+            m_lock_run_task.lock();
+            xtask_ptr->set_running_flag(false);
+            m_lock_run_task.unlock();
+
+            m_xst_get_task.fetch_sub(1);
+        }
+        else
+        {
+            xtask_ptr->set_running_flag(false);
+        }
+
+        x_strand_t * xstrand_ptr = xtask_ptr->m_xstrand_ptr;
+
+        release_capacity(xtask_ptr);
+        recycle_task(xtask_ptr);
+
+        // 放行所属串行执行序列的下一个任务对象
+        if (nullptr != xstrand_ptr)
+        {
+            release_strand(xstrand_ptr);
+        }
+
+        // 运行标识已重置，挂起的任务对象可能已可执行
+        notify_parked();
+    }
+
+    /**********************************************************/
+    /**
+     * @brief 工作线程的执行流程。
+     */
+    void thread_run(x_thread_slot_t & xthread_slot)
+    {
+        size_t xthread_index = xthread_slot.m_xthread_index;
+        x_running_checker_t xht_checker(this, xthread_index, &xthread_slot.m_xcpu);
+
+        x_task_ptr_t xtask_ptr = nullptr;
+
+        // 先按亲和性策略绑定当前线程（NUMA 模式下，其后在所属节点上分配私有数据）
+        pin_worker(xthread_slot);
+
+        // 工作窃取模式下，工作线程的私有数据对象（NUMA 模式下，在所属节点上分配）
+        x_worker_t * xworker_ptr = !m_work_stealing ? nullptr :
+                                   ((m_xnuma_nodes > 0) ? create_numa_worker(xthread_index) : get_worker(xthread_index));
+        this_worker()  = xworker_ptr;
+        this_checker() = &xht_checker;
+
+        x_worker_stats_t & xstats = xthread_slot.m_xstats;
+        this_stats() = &xstats;
+
+        x_idle_backoff_t xbackoff(*this, m_xidle_policy);
+        x_idle_slot_t    xidle_slot;
+        bool             xretired  = false;
+        uint64_t         xtm_last  = m_xtiming ? steady_ns() : 0;
+        uint64_t         xtm_begin = 0;
+
+#if XTHREADPOOL_ENABLE_TRACE
+        x_trace_ring_t * xtrace_ring = nullptr;
+        x_trace_record_t xtrace;
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+        while (is_enable_running())
+        {
+            if (get_lst_task_size() <= 0)
+            {
+                xbackoff.reset();
+                if (!wait_idle_slot(xidle_slot))
+                {
+                    // 空闲超时：未达到下限数量时退出，否则继续等待
+                    if ((xretired = try_reap()))
+                        break;
+                    continue;
+                }
+            }
+
+            if (!is_enable_running() || (xretired = try_retire()))
+            {
+                break;
+            }
+
+            xtask_ptr = (nullptr != xworker_ptr) ? get_task(xworker_ptr) : get_task();
+            if (nullptr == xtask_ptr)
+            {
+                x_worker_stats_t::add(xstats.m_xst_get_fails);
+                if (get_lst_task_size() > 0)
+                    xbackoff.idle();
+                continue;
+            }
+
+            xbackoff.found();
+
+#if XTHREADPOOL_ENABLE_TRACE
+            // 任务对象执行后即被回收，先取出所需的数据
+            xtrace.m_xtm_dequeue = 0;
+            if (trace_enabled())
+            {
+                xtrace.m_xtm_dequeue = steady_ns();
+                xtrace.m_xtm_submit  = xtask_ptr->m_xtm_enqueue;
+                xtrace.m_xlabel      = xtask_ptr->trace_label();
+                this_trace_label()   = nullptr;
+            }
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+            if (m_xtiming)
+            {
+                xtm_begin = steady_ns();
+                x_worker_stats_t::add(xstats.m_xst_idle_ns, xtm_begin - xtm_last);
+                if ((0 != xtask_ptr->m_xtm_enqueue) && (xtm_begin >= xtask_ptr->m_xtm_enqueue))
+                    xstats.add_sojourn(xtm_begin - xtask_ptr->m_xtm_enqueue);
+            }
+
+#if XTHREADPOOL_ENABLE_TRACE
+            if (0 != xtrace.m_xtm_dequeue)
+                xtrace.m_xtm_start = steady_ns();
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+            if (xht_checker.is_enable_running())
+            {
+                xtask_ptr->run(&xht_checker);
+            }
+
+#if XTHREADPOOL_ENABLE_TRACE
+            if (0 != xtrace.m_xtm_dequeue)
+            {
+                xtrace.m_xtm_end = steady_ns();
+                if (nullptr != this_trace_label())
+                    xtrace.m_xlabel = this_trace_label();
+                trace_record(xthread_index, xtrace_ring, xtrace);
+            }
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+            finish_task(xtask_ptr);
+
+            // 先计入执行完成的数量，wait_idle() 返回后即可读取到
+            x_worker_stats_t::add(xstats.m_xst_tasks);
+
+            decrease_task_count();
+
+            if (m_xtiming)
+            {
+                xtm_last = steady_ns();
+                xstats.add_run(xtm_last - xtm_begin);
+            }
+        }
+
+        if (m_xtiming)
+        {
+            x_worker_stats_t::add(xstats.m_xst_idle_ns, steady_ns() - xtm_last);
+        }
+
+        // 退出前，将本地队列中剩余的任务对象转交给其他工作线程
+        reclaim_worker_tasks(xworker_ptr);
+        this_worker()  = nullptr;
+        this_checker() = nullptr;
+        this_stats()   = nullptr;
+
+        // 认领退出时，可能恰好消耗了提交方的唤醒通知，需转交给其他空闲的工作线程
+        if (xretired && (get_lst_task_size() > 0))
+        {
+            notify_idle_worker();
+        }
+
+        on_worker_exit();
+        xthread_slot.m_xexited.store(true, std::memory_order_release);
+    }
+
+    // data members
+private:
+    std::atomic< bool >        m_enable_running;  ///< 工作线程继续运行的标识值
+    mutable x_locker_t         m_lock_thread;     ///< 工作线程对象的队列的同步操作锁（只由 resize() 持有）
+    std::atomic< uint64_t >    m_xthds_state;     ///< 工作线程的 目标数量 与 运行数量（参看 make_thds_state()）
+    std::list< x_thread_slot_t >
+                               m_lst_threads;     ///< 工作线程对象的槽位队列
+    mutable x_locker_t         m_lock_retire;     ///< m_xst_threads 与 m_vec_resizes 的同步操作锁
+    size_t                     m_xst_threads;     ///< 尚未退出的工作线程数量（含已认领退出的）
+    std::vector< x_resize_state_t * >
+                               m_vec_resizes;     ///< 等待完成的 resize_async() 请求
+
+    x_affinity_policy_t        m_xaffinity_policy;///< 工作线程的 CPU 亲和性策略
+    std::vector< int >         m_vec_affinity;    ///< 按策略排列的逻辑 CPU 编号（第 i 个工作线程绑定至 [i % size]）
+
+    size_t                     m_xnuma_nodes;     ///< NUMA 模式下的节点数量（为 0 时未启用 NUMA 模式）
+    std::vector< std::vector< int > >
+                               m_vec_numa_cpus;   ///< 各个节点上可用的逻辑 CPU
+    std::vector< int >         m_vec_cpu_node;    ///< 逻辑 CPU 编号 -> 节点（不在任何节点上的，为 -1）
+    std::unique_ptr< std::atomic< size_t >[] >
+                               m_xnode_rr;        ///< 各个节点内，轮询选取工作线程的计数
+
+    size_t                     m_xmin_thds;       ///< 弹性模式下，工作线程的下限数量
+    size_t                     m_xmax_thds;       ///< 弹性模式下，工作线程的上限数量（为 0 时未启用弹性模式）
+    size_t                     m_xscale_depth;    ///< 增加工作线程的任务队列深度阈值
+    std::chrono::microseconds  m_xscale_sojourn;  ///< 增加工作线程的排队时长阈值
+    std::chrono::milliseconds  m_xscale_interval; ///< 控制线程的检测周期
+    std::chrono::milliseconds  m_xkeep_alive;     ///< 空闲工作线程的存活时长（为 0 时不退出）
+    std::thread                m_xscaler;         ///< 弹性模式的控制线程
+    std::atomic< uint32_t >    m_xscaler_stop;    ///< 控制线程的退出标识（以 futex 等待其变化）
+
+    mutable x_locker_t         m_lock_idle;       ///< 空闲栈（m_xidle_top）的同步操作锁
+    x_idle_slot_t *            m_xidle_top;       ///< 空闲工作线程的等待槽位栈（LIFO，参看 x_idle_slot_t）
+
+    x_task_mpsc_t              m_lst_smt_tasks;   ///< 用于提交操作的任务队列（无锁入队，持有 m_lock_run_task 时出队）
+
+    bool                       m_check_suspened;  ///< 提取任务对象时，是否检测其挂起状态
+    mutable x_locker_t         m_lock_run_task;   ///< 待执行的任务队列的同步操作锁
+    x_task_list_t              m_lst_run_tasks;   ///< 待执行的任务队列
+
+    std::unique_ptr< x_task_ring_t >
+                               m_xring;           ///< 无锁的环形提交队列（未启用时为 nullptr）
+
+    bool                       m_work_stealing;   ///< 是否启用工作窃取的调度模式
+    std::unique_ptr< std::atomic< x_worker_t * >[] >
+                               m_xworker_table;   ///< 工作线程私有数据对象的映射表（按线程索引号）
+    std::atomic< size_t >      m_xworker_count;   ///< m_xworker_table 中已分配的对象数量（只增不减；NUMA 模式下，其中的对象由工作线程按需分配）
+    std::atomic< size_t >      m_xrr_index;       ///< 外部线程提交任务对象时，轮询选取工作线程的计数
+
+    x_strand_shard_t           m_xstrand_shards[ECV_STRAND_SHARDS];  ///< 串行执行序列的分片映射表
+
+    size_t                     m_xpriorities;     ///< 任务对象的优先级数量
+    std::unique_ptr< x_lane_t[] >
+                               m_xlanes;          ///< 高优先级任务对象的车道（索引号 = 优先级 - 1）
+    size_t                     m_xlane_count;     ///< m_xlanes 中的车道数量（只增不减）
+    size_t                     m_xaging_quota;    ///< 老化处理的跳过次数阈值（为 0 时不做老化处理）
+    size_t                     m_xst_low_skips;   ///< 优先级 0 的任务队列非空时，被车道连续抢先的次数
+    std::atomic< size_t >      m_xst_prio_tasks;  ///< 各个车道中的任务对象总数量
+
+    std::atomic< x_timer_wheel_t * >
+                               m_xtimer_wheel;    ///< 定时任务的时间轮（首次提交定时任务时创建）
+
+    bool                       m_xcap_enabled;    ///< 是否启用容量限制
+    size_t                     m_xcap_tasks;      ///< 任务对象数量的容量上限（为 0 时不限制）
+    size_t                     m_xcap_bytes;      ///< 任务对象内存估算值的容量上限（为 0 时不限制）
+    x_overflow_policy_t        m_xcap_policy;     ///< 达到容量上限时的处理策略
+    mutable x_locker_t         m_lock_capacity;   ///< 提交方等待容量时（配合 m_xcap_notifier）的同步操作锁
+    std::condition_variable    m_xcap_notifier;   ///< 提交方等待容量的通知器
+    std::atomic< size_t >      m_xst_cap_waiters; ///< 等待容量的提交方线程数量
+    std::atomic< size_t >      m_xst_cap_tasks;   ///< 计入容量统计的任务对象数量
+    std::atomic< size_t >      m_xst_cap_bytes;   ///< 计入容量统计的内存估算值
+
+    std::atomic< size_t >      m_xst_idle_thds;   ///< 处于等待状态的工作线程数量
+    x_idle_policy_t            m_xidle_policy;    ///< 提取不到可执行的任务对象时，工作线程的退避策略
+    std::atomic< size_t >      m_xst_parked;      ///< 已登记挂起等待（参看 x_idle_backoff_t）的工作线程数量
+    std::atomic< uint32_t >    m_xpark_epoch;     ///< 挂起等待的工作线程以 futex 等待其变化（参看 notify_parked()）
+    std::atomic< size_t >      m_xst_get_task;    ///< 仅为 0 时，表示当前可提取待执行的任务对象
+    std::atomic< size_t >      m_xst_lst_tasks;   ///< 任务队列中的对象数量
+    std::atomic< size_t >      m_xst_task_count;  ///< 任务对象总数量的计数器
+
+    std::atomic< uint32_t >    m_xidle_epoch;     ///< 任务对象总数量每次降为 0 时递增（wait_idle() 以 futex 等待其变化）
+    std::atomic< size_t >      m_xst_idle_waiters;///< wait_idle() 的等待方数量
+
+    bool                       m_xtiming;         ///< 是否统计时长类的运行指标
+    const uint64_t             m_xtm_created;     ///< 线程池对象创建的时间点（纳秒，参看 steady_ns()）
+    mutable x_locker_t         m_lock_metrics;    ///< 增删 m_lst_threads 的槽位与读取统计计数（snapshot()）的同步操作锁
+    x_worker_metrics_t         m_xretired_metrics;///< 已移除的槽位上累计的统计值
+    char                       m_xpad1[64];
+    std::atomic< uint64_t >    m_xst_submitted;   ///< 入队的任务对象数量（独占缓存行）
+    char                       m_xpad2[64 - sizeof(std::atomic< uint64_t >)];
+
+#if XTHREADPOOL_ENABLE_TRACE
+    std::atomic< bool >        m_xtracing;        ///< 是否正在记录追踪记录
+    std::atomic< size_t >      m_xtrace_capacity; ///< 每个工作线程的追踪记录缓存容量（2 的幂）
+    std::atomic< uint64_t >    m_xtrace_since;    ///< 最近一次 start_trace() 的时间点（导出时忽略此前结束的记录）
+    std::vector< std::unique_ptr< x_trace_ring_t > >
+                               m_vec_trace_rings; ///< 各个工作线程的追踪记录缓存（按线程索引号；由 m_lock_metrics 保护）
+#endif // XTHREADPOOL_ENABLE_TRACE
+
+#if XTHREADPOOL_HAS_COROUTINE
+    mutable std::atomic< x_frame_alloc_t * >
+                               m_xframe_alloc;    ///< 协程帧的回收分配器（首次创建协程帧时创建）
+#endif // XTHREADPOOL_HAS_COROUTINE
+};
+
+//====================================================================
+
+#ifndef SELECTANY
+#ifdef _MSC_VER
+#define SELECTANY   __declspec(selectany)
+#else // !_MSC_VER
+#define SELECTANY   __attribute__((weak))
+#endif // _MSC_VER
+#endif // SELECTANY
+
+/* 任务对象的通用删除器 */
+SELECTANY x_threadpool_t::x_task_deleter_t x_threadpool_t::_S_task_common_deleter;
+
+//====================================================================
+
+typedef x_threadpool_t::x_running_checker_t x_running_checker_t;
+typedef x_threadpool_t::x_task_t            x_task_t;
+typedef x_threadpool_t::x_task_deleter_t    x_task_deleter_t;
+typedef x_threadpool_t::x_task_ptr_t        x_task_ptr_t;
+typedef x_threadpool_t::x_timer_t           x_timer_t;
+typedef x_threadpool_t::x_task_group_t      x_task_group_t;
+typedef x_threadpool_t::x_task_graph_t      x_task_graph_t;
+
+template< typename _Ty >
+using x_future_t = x_threadpool_t::x_future_t< _Ty >;
+
+#if XTHREADPOOL_HAS_COROUTINE
+template< typename _Ty = void >
+using x_co_task_t = x_threadpool_t::x_co_task_t< _Ty >;
+#endif // XTHREADPOOL_HAS_COROUTINE
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // __XTHREADPOOL_H__